@@ -0,0 +1,527 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+/*
+ * Micro benchmarks for the drawing primitives of OLEDDisplay.
+ *
+ * Every primitive is run for all geometries and colors against a virtual
+ * display. The result is reported as ns per call and as pixels per second,
+ * where the pixel count is the number of pixels a call sets when drawn in
+ * WHITE onto an empty screen (i.e. after clipping).
+ *
+ * The display() cases measure the CPU time of the diff and transfer code for
+ * an unchanged frame, a frame with one changed glyph sized area and a fully
+ * changed frame, and report the bytes sent to the virtual display per frame.
+ *
+ * The font cases draw the same text with the plain and the bit packed version
+ * of each bundled font and report the flash size of the font.
+ *
+ * Usage: oleddisplay_bench [--filter TEXT] [--min-time MS] [--json FILE] [--baseline FILE]
+ */
+
+#include <chrono>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "SSD1306Virtual.h"
+#include "OLEDDisplayFixed.h"
+#include "OLEDDisplayFontsPacked.h"
+#include "../examples/SSD1306SimpleDemo/images.h"
+
+#define BENCH_CALLS 64      // Distinct calls per workload, cycled through while timing
+#define BENCH_REPEAT 5      // Timing runs per case, the fastest one is reported
+
+typedef void (*BenchFunction)(OLEDDisplay &display, uint16_t call);
+
+struct BenchGeometry {
+  const char          *name;
+  OLEDDISPLAY_GEOMETRY geometry;
+  uint16_t             width;
+  uint16_t             height;
+};
+
+struct BenchCase {
+  const char    *name;
+  BenchFunction  function;
+};
+
+// One workload, called on the generic display and on an OLEDDisplayFixed
+struct BenchFixedCase {
+  const char    *name;
+  BenchFunction  generic;
+  BenchFunction  fixed;
+};
+
+typedef OLEDDisplayFixed<SSD1306Virtual, 128, 64> FixedDisplay;
+
+struct BenchFont {
+  const char    *name;
+  const uint8_t *plain;
+  uint32_t       plainBytes;
+  const uint8_t *packed;
+  uint32_t       packedBytes;
+};
+
+struct BenchResult {
+  std::string name;
+  double      nsPerCall;
+  double      pixelsPerSecond;
+  int32_t     busBytes;         // Bytes on the wire per frame, -1 if not applicable
+  int32_t     fontBytes;        // Flash used by the font, -1 if not applicable
+};
+
+static const BenchGeometry geometries[] = {
+  { "128x64", GEOMETRY_128_64, 0, 0 },
+  { "128x32", GEOMETRY_128_32, 0, 0 },
+  { "64x48",  GEOMETRY_64_48,  0, 0 },
+  { "64x32",  GEOMETRY_64_32,  0, 0 },
+  { "raw160x80", GEOMETRY_RAWMODE, 160, 80 },
+};
+
+static const struct { const char *name; OLEDDISPLAY_COLOR color; } colors[] = {
+  { "WHITE", WHITE },
+  { "BLACK", BLACK },
+  { "INVERSE", INVERSE },
+};
+
+// 32x32 image in the internal (drawFastImage) format
+static uint8_t fastImage[32 * 4];
+
+// Pseudo random but reproducible coordinates, partially off screen
+static int16_t coords[BENCH_CALLS][6];
+
+static void initWorkload(uint16_t width, uint16_t height) {
+  uint32_t seed = 0x12345678;
+  for (uint16_t i = 0; i < BENCH_CALLS; i++) {
+    for (uint8_t j = 0; j < 6; j++) {
+      seed = seed * 1664525 + 1013904223;
+      uint16_t range = (j & 1) ? height : width;
+      coords[i][j] = (int16_t) ((seed >> 16) % (range + range / 4)) - range / 8;
+    }
+  }
+  for (uint16_t i = 0; i < sizeof(fastImage); i++) {
+    fastImage[i] = (uint8_t) (i * 37 + 11);
+  }
+}
+
+static void benchDrawLine(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawLine(c[0], c[1], c[2], c[3]);
+}
+
+static void benchFillRect(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.fillRect(c[0], c[1], c[2] / 2, c[3] / 2);
+}
+
+static void benchFillCircle(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.fillCircle(c[0], c[1], (c[3] & 15) + 2);
+}
+
+static void benchFillTriangle(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.fillTriangle(c[0], c[1], c[2], c[3], c[4], c[5]);
+}
+
+static void benchDrawXbm(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawXbm(c[0], c[1], WiFi_Logo_width, WiFi_Logo_height, WiFi_Logo_bits);
+}
+
+static void benchDrawFastImage(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawFastImage(c[0], c[1], 32, 32, fastImage);
+}
+
+static void benchDrawString(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawString(c[0], c[1], "Hello World 12:34");
+}
+
+static void benchDrawStringMaxWidth(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawStringMaxWidth(c[0], c[1], 64, "The quick brown fox jumps over the lazy dog");
+}
+
+// A clock on page aligned rows, from the font and from an atlas of its digits
+static OLEDDisplayAtlas clockAtlas;
+
+static void benchDrawClock(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawString(c[0], c[1] & ~7, "12:34:56");
+}
+
+static void benchDrawClockAtlas(OLEDDisplay &display, uint16_t call) {
+  const int16_t *c = coords[call];
+  display.drawStringAtlas(c[0], c[1] & ~7, clockAtlas, "12:34:56");
+}
+
+// The same frame every call, nothing to send
+static void benchDisplayNoop(OLEDDisplay &display, uint16_t) {
+  display.display();
+}
+
+// A glyph sized change at a different place every call. INVERSE so a place
+// that comes around again changes too.
+static void benchDisplayGlyph(OLEDDisplay &display, uint16_t call) {
+  display.setColor(INVERSE);
+  display.fillRect(call * 13 % (display.getWidth() - 6), call * 7 % (display.getHeight() - 10), 6, 10);
+  display.setColor(WHITE);
+  display.display();
+}
+
+// Every pixel changes every call
+static void benchDisplayFull(OLEDDisplay &display, uint16_t) {
+  display.setColor(INVERSE);
+  display.fillRect(0, 0, display.getWidth(), display.getHeight());
+  display.setColor(WHITE);
+  display.display();
+}
+
+// Scrolling by a page with the display start line, then filling the new page
+static void benchScrollPage(OLEDDisplay &display, uint16_t call) {
+  char line[32];
+  snprintf(line, sizeof(line), "12:34:%02u sensor %u ok", call % 60, call % 8);
+  display.scrollPages(1);
+  display.drawString(0, display.getHeight() - 8, line);
+  display.display();
+}
+
+// The console of the Print interface, a char at a time and a line at a time
+static void benchPrintChar(OLEDDisplay &display, uint16_t call) {
+  static const char line[] = "12:34:56 sensor 3 ok\n";
+  display.write((uint8_t) line[call % (sizeof(line) - 1)]);
+}
+
+static void benchPrintLine(OLEDDisplay &display, uint16_t call) {
+  display.printf("12:34:%02u sensor %u ok\n", call % 60, call % 8);
+}
+
+// D is the type the drawing function is called on, OLEDDisplayFixed replaces
+// (not overrides) them
+template <class D> static void benchSetPixel(OLEDDisplay &display, uint16_t call) {
+  D &d = static_cast<D &>(display);
+  const int16_t *c = coords[call];
+  for (int16_t i = 0; i < 32; i++) {
+    d.setPixel(c[0] + i, c[1] + (i >> 1));
+  }
+}
+
+template <class D> static void benchHorizontalLine(OLEDDisplay &display, uint16_t call) {
+  D &d = static_cast<D &>(display);
+  const int16_t *c = coords[call];
+  d.drawHorizontalLine(c[0], c[1], c[2] / 2);
+}
+
+template <class D> static void benchFastImage(OLEDDisplay &display, uint16_t call) {
+  D &d = static_cast<D &>(display);
+  const int16_t *c = coords[call];
+  d.drawFastImage(c[0], c[1], 32, 32, fastImage);
+}
+
+static const BenchCase cases[] = {
+  { "drawLine",           benchDrawLine },
+  { "fillRect",           benchFillRect },
+  { "fillCircle",         benchFillCircle },
+  { "fillTriangle",       benchFillTriangle },
+  { "drawXbm",            benchDrawXbm },
+  { "drawFastImage",      benchDrawFastImage },
+  { "drawString",         benchDrawString },
+  { "drawStringMaxWidth", benchDrawStringMaxWidth },
+  { "drawClock",          benchDrawClock },
+  { "drawClockAtlas",     benchDrawClockAtlas },
+};
+
+static const BenchCase displayCases[] = {
+  { "display/noop",  benchDisplayNoop },
+  { "display/glyph", benchDisplayGlyph },
+  { "display/full",  benchDisplayFull },
+  { "scroll/page",   benchScrollPage },
+  { "print/char",    benchPrintChar },
+  { "print/line",    benchPrintLine },
+};
+
+#define BENCH_FONT(name) { #name, name, sizeof(name), name##_Packed, sizeof(name##_Packed) }
+static const BenchFont fonts[] = {
+  BENCH_FONT(ArialMT_Plain_10),
+  BENCH_FONT(ArialMT_Plain_16),
+  BENCH_FONT(ArialMT_Plain_24),
+};
+
+static const BenchFixedCase fixedCases[] = {
+  { "setPixel",           benchSetPixel<SSD1306Virtual>,       benchSetPixel<FixedDisplay> },
+  { "drawHorizontalLine", benchHorizontalLine<SSD1306Virtual>, benchHorizontalLine<FixedDisplay> },
+  { "drawFastImage",      benchFastImage<SSD1306Virtual>,      benchFastImage<FixedDisplay> },
+};
+
+static uint32_t countPixels(const OLEDDisplay &display, uint32_t bytes) {
+  uint32_t pixels = 0;
+  for (uint32_t i = 0; i < bytes; i++) {
+    pixels += __builtin_popcount(display.buffer[i]);
+  }
+  return pixels;
+}
+
+static double runCase(OLEDDisplay &display, BenchFunction function, double minTimeNs) {
+  typedef std::chrono::steady_clock Clock;
+
+  uint32_t iterations = BENCH_CALLS;
+  double best = 0;
+  for (uint8_t repeat = 0; repeat < BENCH_REPEAT; repeat++) {
+    double elapsed;
+    for (;;) {
+      Clock::time_point start = Clock::now();
+      for (uint32_t i = 0; i < iterations; i++) {
+        function(display, i % BENCH_CALLS);
+      }
+      elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+      if (elapsed >= minTimeNs) break;
+      iterations *= 2;
+    }
+    double nsPerCall = elapsed / iterations;
+    if (repeat == 0 || nsPerCall < best) best = nsPerCall;
+  }
+  return best;
+}
+
+static void printResult(const BenchResult &result, const std::map<std::string, double> &baseline) {
+  char delta[32] = "";
+  std::map<std::string, double>::const_iterator base = baseline.find(result.name);
+  if (base != baseline.end() && base->second > 0) {
+    snprintf(delta, sizeof(delta), "%+.1f%%", (result.nsPerCall / base->second - 1) * 100);
+  }
+  if (result.busBytes >= 0) {
+    printf("%-48s %12.1f %10d bytes %10s\n", result.name.c_str(), result.nsPerCall, (int) result.busBytes, delta);
+  } else if (result.fontBytes >= 0) {
+    printf("%-48s %12.1f %16.0f %10s %6d bytes of font\n", result.name.c_str(), result.nsPerCall, result.pixelsPerSecond,
+           delta, (int) result.fontBytes);
+  } else {
+    printf("%-48s %12.1f %16.0f %10s\n", result.name.c_str(), result.nsPerCall, result.pixelsPerSecond, delta);
+  }
+  fflush(stdout);
+}
+
+static std::map<std::string, double> readBaseline(const char *path) {
+  std::map<std::string, double> baseline;
+  std::ifstream file(path);
+  std::string line;
+  while (std::getline(file, line)) {
+    size_t name = line.find("\"name\": \"");
+    size_t ns = line.find("\"ns_per_call\": ");
+    if (name == std::string::npos || ns == std::string::npos) continue;
+    name += 9;
+    baseline[line.substr(name, line.find('"', name) - name)] = atof(line.c_str() + ns + 15);
+  }
+  return baseline;
+}
+
+static void writeJson(const char *path, const std::vector<BenchResult> &results) {
+  std::ofstream file(path);
+  file << "{\n  \"benchmarks\": [\n";
+  for (size_t i = 0; i < results.size(); i++) {
+    char line[256];
+    if (results[i].busBytes >= 0) {
+      snprintf(line, sizeof(line), "    { \"name\": \"%s\", \"ns_per_call\": %.1f, \"bus_bytes\": %d }%s\n",
+               results[i].name.c_str(), results[i].nsPerCall, (int) results[i].busBytes,
+               i + 1 < results.size() ? "," : "");
+    } else if (results[i].fontBytes >= 0) {
+      snprintf(line, sizeof(line), "    { \"name\": \"%s\", \"ns_per_call\": %.1f, \"pixels_per_second\": %.0f, \"font_bytes\": %d }%s\n",
+               results[i].name.c_str(), results[i].nsPerCall, results[i].pixelsPerSecond, (int) results[i].fontBytes,
+               i + 1 < results.size() ? "," : "");
+    } else {
+      snprintf(line, sizeof(line), "    { \"name\": \"%s\", \"ns_per_call\": %.1f, \"pixels_per_second\": %.0f }%s\n",
+               results[i].name.c_str(), results[i].nsPerCall, results[i].pixelsPerSecond,
+               i + 1 < results.size() ? "," : "");
+    }
+    file << line;
+  }
+  file << "  ]\n}\n";
+}
+
+int main(int argc, char **argv) {
+  const char *filter = NULL;
+  const char *jsonPath = NULL;
+  const char *baselinePath = NULL;
+  double minTimeNs = 20e6;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--filter" && i + 1 < argc) {
+      filter = argv[++i];
+    } else if (arg == "--json" && i + 1 < argc) {
+      jsonPath = argv[++i];
+    } else if (arg == "--baseline" && i + 1 < argc) {
+      baselinePath = argv[++i];
+    } else if (arg == "--min-time" && i + 1 < argc) {
+      minTimeNs = atof(argv[++i]) * 1e6;
+    } else {
+      fprintf(stderr, "Usage: %s [--filter TEXT] [--min-time MS] [--json FILE] [--baseline FILE]\n", argv[0]);
+      return 1;
+    }
+  }
+
+  std::map<std::string, double> baseline;
+  if (baselinePath) {
+    baseline = readBaseline(baselinePath);
+  }
+
+  std::vector<BenchResult> results;
+  printf("%-48s %12s %16s %10s\n", "benchmark", "ns/call", "pixels/s", "vs base");
+
+  for (const BenchGeometry &g : geometries) {
+    SSD1306Virtual display(g.geometry, g.width, g.height);
+    display.init();
+    display.setFont(ArialMT_Plain_16);
+    display.createAtlas(clockAtlas, "0123456789:");
+    const uint32_t bytes = display.getWidth() * display.getHeight() / 8;
+    initWorkload(display.getWidth(), display.getHeight());
+
+    for (const BenchCase &c : cases) {
+      // Pixels per call: draw each call once in WHITE on an empty screen
+      uint64_t pixels = 0;
+      display.setColor(WHITE);
+      for (uint16_t i = 0; i < BENCH_CALLS; i++) {
+        display.clear();
+        c.function(display, i);
+        pixels += countPixels(display, bytes);
+      }
+      double pixelsPerCall = (double) pixels / BENCH_CALLS;
+
+      for (const auto &color : colors) {
+        std::string name = std::string(c.name) + "/" + g.name + "/" + color.name;
+        if (filter && name.find(filter) == std::string::npos) continue;
+
+        display.clear();
+        display.setColor(color.color);
+        BenchResult result;
+        result.name = name;
+        result.nsPerCall = runCase(display, c.function, minTimeNs);
+        result.pixelsPerSecond = pixelsPerCall * 1e9 / result.nsPerCall;
+        result.busBytes = -1;
+        result.fontBytes = -1;
+        results.push_back(result);
+        printResult(result, baseline);
+      }
+    }
+
+    display.freeAtlas(clockAtlas);
+    if (g.geometry == GEOMETRY_RAWMODE) continue;
+
+    display.setColor(INVERSE);
+    for (const BenchCase &c : displayCases) {
+      std::string name = std::string(c.name) + "/" + g.name;
+      if (filter && name.find(filter) == std::string::npos) continue;
+
+      display.clear();
+      display.display();
+      c.function(display, 0);
+      OLEDDisplayBusStats stats = display.getFrameStats();
+
+      BenchResult result;
+      result.name = name;
+      result.nsPerCall = runCase(display, c.function, minTimeNs);
+      result.pixelsPerSecond = 0;
+      result.busBytes = stats.wireBytes;
+      result.fontBytes = -1;
+      results.push_back(result);
+      printResult(result, baseline);
+    }
+  }
+
+  // Runtime against compile time geometry, 128x64 in WHITE
+  SSD1306Virtual generic(GEOMETRY_128_64);
+  FixedDisplay fixed;
+  generic.init();
+  fixed.init();
+  initWorkload(128, 64);
+  for (const BenchFixedCase &c : fixedCases) {
+    for (uint8_t variant = 0; variant < 2; variant++) {
+      OLEDDisplay &display = variant ? (OLEDDisplay &) fixed : (OLEDDisplay &) generic;
+      BenchFunction function = variant ? c.fixed : c.generic;
+      std::string name = std::string(c.name) + "/128x64/" + (variant ? "fixed" : "generic");
+      if (filter && name.find(filter) == std::string::npos) continue;
+
+      uint64_t pixels = 0;
+      display.setColor(WHITE);
+      for (uint16_t i = 0; i < BENCH_CALLS; i++) {
+        display.clear();
+        function(display, i);
+        pixels += countPixels(display, 128 * 64 / 8);
+      }
+
+      display.clear();
+      BenchResult result;
+      result.name = name;
+      result.nsPerCall = runCase(display, function, minTimeNs);
+      result.pixelsPerSecond = (double) pixels / BENCH_CALLS * 1e9 / result.nsPerCall;
+      result.busBytes = -1;
+      result.fontBytes = -1;
+      results.push_back(result);
+      printResult(result, baseline);
+    }
+  }
+
+  // Plain against bit packed fonts, 128x64 in WHITE
+  for (const BenchFont &f : fonts) {
+    for (uint8_t variant = 0; variant < 2; variant++) {
+      std::string name = std::string("drawString/") + f.name + "/" + (variant ? "packed" : "plain");
+      if (filter && name.find(filter) == std::string::npos) continue;
+
+      generic.setFont(variant ? f.packed : f.plain);
+      uint64_t pixels = 0;
+      generic.setColor(WHITE);
+      for (uint16_t i = 0; i < BENCH_CALLS; i++) {
+        generic.clear();
+        benchDrawString(generic, i);
+        pixels += countPixels(generic, 128 * 64 / 8);
+      }
+
+      generic.clear();
+      BenchResult result;
+      result.name = name;
+      result.nsPerCall = runCase(generic, benchDrawString, minTimeNs);
+      result.pixelsPerSecond = (double) pixels / BENCH_CALLS * 1e9 / result.nsPerCall;
+      result.busBytes = -1;
+      result.fontBytes = variant ? f.packedBytes : f.plainBytes;
+      results.push_back(result);
+      printResult(result, baseline);
+    }
+  }
+
+  if (jsonPath) {
+    writeJson(jsonPath, results);
+  }
+  return 0;
+}
@@ -0,0 +1,266 @@
+#!/usr/bin/env python3
+"""
+Converts fonts from the format of OLEDDisplayFonts.h (as created by the font
+tool at http://oleddisplay.squix.ch) to the extended formats of OLEDDisplay.h.
+
+By default every font array found in the input is written to the output bit
+packed as <name>_Packed, which needs about a third less flash for the larger
+sizes:
+
+    python3 fontConverter.py ../src/OLEDDisplayFonts.h ../src/OLEDDisplayFontsPacked.h
+
+With --ranges the fonts are written as <name>_Ranged with only the given
+Unicode code points, drawn from UTF-8 text. --encoding tells which code points
+the char codes of the input fonts stand for, --merge combines several fonts of
+the same height (e.g. a Latin and a Cyrillic one) into one:
+
+    python3 fontConverter.py Fonts.h FontsRanged.h --ranges 0x20-0x7E,0xB0 --font Latin_16
+    python3 fontConverter.py Fonts.h FontsRanged.h --ranges 0x20-0x7E,0x401-0x451 \\
+        --font Latin_16 --font Cyrillic_16 --encoding cp1251 --merge Mixed_16
+
+Format of the output:
+
+    0x00                 Marks the extended header (the width of plain fonts)
+    height, first char, number of chars (both 0 in ranged fonts)
+    flags                FONT_BITPACKED, FONT_RANGES
+    width
+    ranges               Ranged fonts only: the number of ranges, then per range
+                         the first code point (3 bytes, MSB first), the number
+                         of chars and the jump table index of the first one
+                         (MSB first)
+    jump table           4 bytes per char, as in plain fonts: offset of the
+                         glyph data (MSB, LSB, 0xFFFF if there is nothing to
+                         draw), its size in bytes and the width of the char
+    glyph data           Bit packed: per glyph the number of columns, the first
+                         row and the number of rows of its ink, then the bits
+                         of those rows of every column, LSB first. Otherwise
+                         the column major raster of plain fonts.
+"""
+
+import argparse
+import re
+import sys
+
+FONT_BITPACKED = 0x01
+FONT_RANGES = 0x02
+
+
+def parse_fonts(source):
+    """Returns (name, bytes) of every font array in the C source."""
+    fonts = []
+    for match in re.finditer(r'(?:const\s+)?(?:uint8_t|char)\s+(\w+)\s*\[\s*\]\s*(?:PROGMEM\s*)?=\s*\{(.*?)\};', source, re.S):
+        body = re.sub(r'//[^\n]*|/\*.*?\*/', '', match.group(2), flags=re.S)
+        values = [int(value, 0) for value in re.findall(r'0[xX][0-9A-Fa-f]+|\d+', body)]
+        fonts.append((match.group(1), values))
+    return fonts
+
+
+def read_glyphs(name, font):
+    """Returns width, height and the (advance, raster or None) of every char code."""
+    width, height, first_char, char_count = font[0:4]
+    if width == 0:
+        raise ValueError('%s is already in an extended format' % name)
+    data_start = 4 + char_count * 4
+
+    glyphs = {}
+    for index in range(char_count):
+        jump = 4 + index * 4
+        raster = None
+        if font[jump] != 0xFF or font[jump + 1] != 0xFF:
+            position = data_start + (font[jump] << 8) + font[jump + 1]
+            raster = font[position:position + font[jump + 2]]
+        glyphs[first_char + index] = (font[jump + 3], raster)
+    return width, height, glyphs
+
+
+def pack_glyph(raster, raster_height):
+    """Returns the bit packed glyph, None if it has no ink."""
+    columns = (len(raster) + raster_height - 1) // raster_height
+    raster = raster + [0] * (columns * raster_height - len(raster))
+    bits = [sum(raster[column * raster_height + row] << (8 * row) for row in range(raster_height))
+            for column in range(columns)]
+
+    ink = 0
+    for column in bits:
+        ink |= column
+    if ink == 0:
+        return None
+    while bits[-1] == 0:
+        bits.pop()
+    top = (ink & -ink).bit_length() - 1
+    rows = ink.bit_length() - top
+
+    stream = 0
+    for column, value in enumerate(bits):
+        stream |= ((value >> top) & ((1 << rows) - 1)) << (column * rows)
+    return [len(bits), top, rows] + list(stream.to_bytes((len(bits) * rows + 7) // 8, 'little'))
+
+
+def parse_ranges(spec):
+    codes = set()
+    for part in spec.split(','):
+        bounds = part.split('-')
+        first = int(bounds[0], 0)
+        codes.update(range(first, int(bounds[-1], 0) + 1))
+    return codes
+
+
+def build_font(name, width, height, glyphs, codes, flags):
+    """Lays out the font with the given char codes (all of the range from the
+    first to the last one unless FONT_RANGES is set)."""
+    raster_height = (height + 7) // 8
+    codes = sorted(codes)
+    if not flags & FONT_RANGES:
+        codes = list(range(codes[0], codes[-1] + 1))
+
+    ranges = []
+    if flags & FONT_RANGES:
+        for index, code in enumerate(codes):
+            if ranges and ranges[-1][0] + ranges[-1][1] == code and ranges[-1][1] < 255:
+                ranges[-1][1] += 1
+            else:
+                ranges.append([code, 1, index])
+        if len(ranges) > 255:
+            raise ValueError('%s: too many ranges' % name)
+
+    jump_table = []
+    data = []
+    offset = 0
+    for code in codes:
+        advance, raster = glyphs.get(code, (0, None))
+        if raster and flags & FONT_BITPACKED:
+            raster = pack_glyph(raster, raster_height)
+        if not raster:
+            jump_table.append((code, 0xFFFF, 0, advance))
+            continue
+        if len(raster) > 255 or offset >= 0xFFFF:
+            raise ValueError('%s: glyph %d does not fit into the jump table' % (name, code))
+        jump_table.append((code, offset, len(raster), advance))
+        data.append((code, raster))
+        offset += len(raster)
+
+    size = 6 + (1 + len(ranges) * 6 if flags & FONT_RANGES else 0) + len(codes) * 4 + offset
+    if size > 0xFFFF:
+        raise ValueError('%s: the font is larger than 64 KB' % name)
+    return {
+        'name': name,
+        'width': width,
+        'height': height,
+        'flags': flags,
+        'first_char': 0 if flags & FONT_RANGES else codes[0],
+        'char_count': 0 if flags & FONT_RANGES else len(codes),
+        'ranges': ranges,
+        'jump_table': jump_table,
+        'data': data,
+        'size': size,
+    }
+
+
+def hex_list(values, separator=','):
+    return separator.join('0x%02X' % value for value in values)
+
+
+def char_name(font, code):
+    return 'U+%04X' % code if font['flags'] & FONT_RANGES else str(code)
+
+
+def write_font(out, font, comment):
+    flags = [text for flag, text in ((FONT_BITPACKED, 'bit packed'), (FONT_RANGES, 'ranges')) if font['flags'] & flag]
+    out.write('// %s\n' % comment)
+    out.write('const uint8_t %s[] PROGMEM = {\n' % font['name'])
+    out.write('  0x00, // Extended header\n')
+    out.write('  0x%02X, // Height: %d\n' % (font['height'], font['height']))
+    out.write('  0x%02X, // First Char: %d\n' % (font['first_char'], font['first_char']))
+    out.write('  0x%02X, // Numbers of Chars: %d\n' % (font['char_count'], font['char_count']))
+    out.write('  0x%02X, // Flags: %s\n' % (font['flags'], ', '.join(flags)))
+    out.write('  0x%02X, // Width: %d\n' % (font['width'], font['width']))
+    if font['flags'] & FONT_RANGES:
+        out.write('\n  // Ranges:\n')
+        out.write('  0x%02X,\n' % len(font['ranges']))
+        for first, count, index in font['ranges']:
+            out.write('  %s,  // U+%04X-U+%04X\n' % (
+                hex_list([first >> 16, (first >> 8) & 0xFF, first & 0xFF, count, index >> 8, index & 0xFF], ', '),
+                first, first + count - 1))
+    out.write('\n  // Jump Table:\n')
+    for code, offset, size, advance in font['jump_table']:
+        out.write('  %s,  // %s:%d\n' % (hex_list([offset >> 8, offset & 0xFF, size, advance], ', '),
+                                         char_name(font, code), offset))
+    out.write('  // Font Data:\n')
+    for code, raster in font['data']:
+        out.write('  %s,  // %s\n' % (hex_list(raster), char_name(font, code)))
+    out.write('};\n')
+
+
+def to_code_points(glyphs, encoding):
+    """Maps the char codes of a font to the code points they stand for."""
+    mapped = {}
+    for code, glyph in glyphs.items():
+        try:
+            char = bytes([code]).decode(encoding) if code < 256 else chr(code)
+        except UnicodeDecodeError:
+            continue
+        mapped[ord(char)] = glyph
+    return mapped
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Converts OLEDDisplay fonts to the extended formats')
+    parser.add_argument('input', help='C header with fonts in the plain format')
+    parser.add_argument('output', nargs='?', help='C header to write, stdout if missing')
+    parser.add_argument('--font', action='append', help='Only convert the font with this name (repeatable)')
+    parser.add_argument('--ranges', help='Write ranged fonts with these code points, e.g. 0x20-0x7E,0xB0')
+    parser.add_argument('--encoding', default='latin-1', help='Encoding of the char codes of the input (ranged fonts)')
+    parser.add_argument('--merge', metavar='NAME', help='Merge the fonts into one ranged font with this name')
+    parser.add_argument('--no-pack', action='store_true', help='Keep the glyphs as column major rasters')
+    args = parser.parse_args()
+
+    with open(args.input) as source:
+        fonts = parse_fonts(source.read())
+    if args.font:
+        fonts = sorted((font for font in fonts if font[0] in args.font), key=lambda font: args.font.index(font[0]))
+    if not fonts:
+        sys.exit('No fonts found in %s' % args.input)
+    if args.merge and not args.ranges:
+        sys.exit('--merge needs --ranges')
+
+    flags = (0 if args.no_pack else FONT_BITPACKED) | (FONT_RANGES if args.ranges else 0)
+    suffix = '_Ranged' if args.ranges else '_Packed'
+    converted = []
+    for name, values in fonts:
+        width, height, glyphs = read_glyphs(name, values)
+        if args.ranges:
+            glyphs = to_code_points(glyphs, args.encoding)
+        converted.append((name, values, width, height, glyphs))
+
+    if args.merge:
+        # Earlier fonts win where they overlap
+        height = converted[0][3]
+        glyphs = {}
+        for name, values, font_width, font_height, font_glyphs in reversed(converted):
+            if font_height != height:
+                sys.exit('%s is %d pixels high, not %d' % (name, font_height, height))
+            glyphs.update(font_glyphs)
+        width = max(font[2] for font in converted)
+        sources = sum(len(font[1]) for font in converted)
+        converted = [(args.merge, None, width, height, glyphs)]
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    guard = re.sub(r'\W', '_', args.output.split('/')[-1].replace('.h', '')).upper() + '_h' \
+        if args.output else 'OLEDDISPLAYFONTSPACKED_h'
+    out.write('// Generated by resources/fontConverter.py from %s\n' % args.input.split('/')[-1])
+    out.write('#ifndef %s\n#define %s\n\n#ifdef __MBED__\n#define PROGMEM\n#endif\n\n' % (guard, guard))
+    for name, values, width, height, glyphs in converted:
+        codes = parse_ranges(args.ranges) & set(glyphs) if args.ranges else set(glyphs)
+        if not codes:
+            sys.exit('%s has none of the chars' % name)
+        font = build_font(name if args.merge else name + suffix, width, height, glyphs, codes, flags)
+        source_size = len(values) if values else sources
+        write_font(out, font, '%s: %d bytes instead of %d' % (name, font['size'], source_size))
+        out.write('\n')
+    out.write('#endif\n')
+    if args.output:
+        out.close()
+
+
+if __name__ == '__main__':
+    main()
@@ -42,52 +42,122 @@ OLEDDisplay::OLEDDisplay() {
 	displayHeight = 64;
 	displayBufferSize = displayWidth * displayHeight / 8;
   inhibitDrawLogBuffer = false;
+	logBufferDrawn = false;
+	logBufferSize = 0;
+	logBuffer = NULL;
 	color = WHITE;
 	geometry = GEOMETRY_128_64;
 	textAlignment = TEXT_ALIGN_LEFT;
 	fontData = ArialMT_Plain_10;
+	readFontHeader();
+	logDecoder.codePoint = 0;
+	logDecoder.pending = 0;
 	fontTableLookupFunction = DefaultFontTableLookup;
+	glyphCache = NULL;
+	glyphCacheChars = 0;
+	dirtyRectMergeThreshold = OLEDDISPLAY_DIRTY_RECT_MERGE_THRESHOLD;
+	asyncBusy = false;
+	displayCompleteCallback = NULL;
+	startPage = 0;
+	startLinePending = false;
+	stalePages = 0;
+	scrollActive = false;
+#ifdef OLEDDISPLAY_ASYNC_TASK
+	asyncTask = NULL;
+#endif
 	buffer = NULL;
 #ifdef OLEDDISPLAY_DOUBLE_BUFFER
 	buffer_back = NULL;
+#endif
+	bufferStorage = NULL;
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+	bufferBackStorage = NULL;
+#endif
+	stateStorage = NULL;
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+	pageStates = NULL;
+#endif
+#ifdef OLEDDISPLAY_SEGMENT_HASHES
+	segmentHashes = NULL;
 #endif
 }
 
 OLEDDisplay::~OLEDDisplay() {
   end();
+  setGlyphCache(false);
 }
 
 bool OLEDDisplay::allocateBuffer() {
 
-  logBufferSize = 0;
-  logBufferFilled = 0;
-  logBufferLine = 0;
-  logBufferMaxLines = 0;
-  logBuffer = NULL;
-
   if (!connect()) {
     DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Can't establish connection to display\n");
     return false;
   }
 
+  // Also used without init() to resume after a deep sleep
+  BufferOffset = getBufferOffset();
+
   if(this->buffer==NULL) {
-    this->buffer = (uint8_t*) malloc((sizeof(uint8_t) * displayBufferSize) + BufferOffset);
-    this->buffer += BufferOffset;
+    uint8_t *storage = this->bufferStorage;
+    if (!storage) storage = (uint8_t*) malloc((sizeof(uint8_t) * displayBufferSize) + BufferOffset);
 
-    if(!this->buffer) {
+    if(!storage) {
       DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create display\n");
       return false;
     }
+    this->buffer = storage + BufferOffset;
   }
 
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
   if(this->buffer_back==NULL) {
-    this->buffer_back = (uint8_t*) malloc((sizeof(uint8_t) * displayBufferSize) + BufferOffset);
-    this->buffer_back += BufferOffset;
+    uint8_t *storage = this->bufferBackStorage;
+    if (!storage) storage = (uint8_t*) malloc((sizeof(uint8_t) * displayBufferSize) + BufferOffset);
+    if (storage) this->buffer_back = storage + BufferOffset;
 
     if(!this->buffer_back) {
       DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create back buffer\n");
-      free(this->buffer - BufferOffset);
+      releaseBuffers();
+      return false;
+    }
+  }
+  #endif
+
+  #ifdef OLEDDISPLAY_DIRTY_TRACKING
+  if(this->pageStates==NULL) {
+    if (this->stateStorage) this->pageStates = (OLEDDisplayPageState*) this->stateStorage;
+    else this->pageStates = (OLEDDisplayPageState*) malloc(sizeof(OLEDDisplayPageState) * (displayHeight / 8));
+
+    if(!this->pageStates) {
+      DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create dirty tracking\n");
+      releaseBuffers();
+      return false;
+    }
+
+    // The content of the display is unknown, so all of it has to be cleared
+    for (uint8_t page = 0; page < displayHeight / 8; page++) {
+      pageStates[page].dirtyX0 = pageStates[page].inkX0 = 0;
+      pageStates[page].dirtyX1 = pageStates[page].inkX1 = displayWidth - 1;
+    }
+  }
+  #endif
+
+  #ifdef OLEDDISPLAY_SEGMENT_HASHES
+  if(this->segmentHashes==NULL) {
+    this->segmentsPerPage = (displayWidth + OLEDDISPLAY_HASH_SEGMENT_WIDTH - 1) / OLEDDISPLAY_HASH_SEGMENT_WIDTH;
+    if (this->stateStorage) {
+      this->segmentHashes = (uint32_t*) (this->stateStorage + OLEDDISPLAY_PAGE_STATES_SIZE(displayHeight));
+      memset(this->segmentHashes, 0, segmentsPerPage * (displayHeight / 8) * sizeof(uint32_t));
+    } else {
+      this->segmentHashes = (uint32_t*) calloc(segmentsPerPage * (displayHeight / 8), sizeof(uint32_t));
+    }
+
+    if(!this->segmentHashes) {
+      DEBUG_OLEDDISPLAY("[OLEDDISPLAY][init] Not enough memory to create segment hashes\n");
+      releaseBuffers();
+      #ifdef OLEDDISPLAY_DIRTY_TRACKING
+      free(this->pageStates);
+      this->pageStates = NULL;
+      #endif
       return false;
     }
   }
@@ -111,11 +181,59 @@ bool OLEDDisplay::init() {
 }
 
 void OLEDDisplay::end() {
-  if (this->buffer) { free(this->buffer - BufferOffset); this->buffer = NULL; }
-  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-  if (this->buffer_back) { free(this->buffer_back - BufferOffset); this->buffer_back = NULL; }
+  waitForTransfer();
+  #ifdef OLEDDISPLAY_ASYNC_TASK
+  if (this->asyncTask) { vTaskDelete(this->asyncTask); this->asyncTask = NULL; }
+  #endif
+  releaseBuffers();
+  #ifdef OLEDDISPLAY_DIRTY_TRACKING
+  if (this->pageStates && !this->stateStorage) free(this->pageStates);
+  this->pageStates = NULL;
+  #endif
+  #ifdef OLEDDISPLAY_SEGMENT_HASHES
+  if (this->segmentHashes && !this->stateStorage) free(this->segmentHashes);
+  this->segmentHashes = NULL;
   #endif
   if (this->logBuffer != NULL) { free(this->logBuffer); this->logBuffer = NULL; }
+  this->logBufferSize = 0;
+}
+
+void OLEDDisplay::releaseBuffers() {
+  if (this->buffer && !this->bufferStorage) free(this->buffer - BufferOffset);
+  this->buffer = NULL;
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  if (this->buffer_back && !this->bufferBackStorage) free(this->buffer_back - BufferOffset);
+  this->buffer_back = NULL;
+  #endif
+}
+
+bool OLEDDisplay::setBuffers(uint8_t *storage, uint8_t *backStorage, uint8_t *stateStorage) {
+  if (this->buffer) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setBuffers] Call end() first\n");
+    return false;
+  }
+  if (((uintptr_t) storage | (uintptr_t) backStorage | (uintptr_t) stateStorage) & (OLEDDISPLAY_BUFFER_ALIGNMENT - 1)) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setBuffers] Storage is not aligned\n");
+    return false;
+  }
+  #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  if (storage && !backStorage) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setBuffers] Double buffering needs backStorage\n");
+    return false;
+  }
+  this->bufferBackStorage = storage ? backStorage : NULL;
+  #endif
+  this->bufferStorage = storage;
+  this->stateStorage = storage && getStateSize() ? stateStorage : NULL;
+  return true;
+}
+
+uint16_t OLEDDisplay::getBufferSize(void) {
+  return displayBufferSize + getBufferOffset();
+}
+
+uint16_t OLEDDisplay::getStateSize(void) {
+  return OLEDDISPLAY_STATE_SIZE(displayWidth, displayHeight);
 }
 
 void OLEDDisplay::resetDisplay(void) {
@@ -123,6 +241,10 @@ void OLEDDisplay::resetDisplay(void) {
   #ifdef OLEDDISPLAY_DOUBLE_BUFFER
   memset(buffer_back, 1, displayBufferSize);
   #endif
+  #ifdef OLEDDISPLAY_SEGMENT_HASHES
+  memset(segmentHashes, 0, segmentsPerPage * (this->height() / 8) * sizeof(uint32_t));
+  #endif
+  markDirty(0, 0, this->width(), this->height());
   display();
 }
 
@@ -136,6 +258,7 @@ OLEDDISPLAY_COLOR OLEDDisplay::getColor() {
 
 void OLEDDisplay::setPixel(int16_t x, int16_t y) {
   if (x >= 0 && x < this->width() && y >= 0 && y < this->height()) {
+    touchRegion(x, x, y >> 3, y >> 3);
     switch (color) {
       case WHITE:   buffer[x + (y / 8) * this->width()] |=  (1 << (y & 7)); break;
       case BLACK:   buffer[x + (y / 8) * this->width()] &= ~(1 << (y & 7)); break;
@@ -146,6 +269,7 @@ void OLEDDisplay::setPixel(int16_t x, int16_t y) {
 
 void OLEDDisplay::setPixelColor(int16_t x, int16_t y, OLEDDISPLAY_COLOR color) {
   if (x >= 0 && x < this->width() && y >= 0 && y < this->height()) {
+    touchRegion(x, x, y >> 3, y >> 3);
     switch (color) {
       case WHITE:   buffer[x + (y / 8) * this->width()] |=  (1 << (y & 7)); break;
       case BLACK:   buffer[x + (y / 8) * this->width()] &= ~(1 << (y & 7)); break;
@@ -156,6 +280,7 @@ void OLEDDisplay::setPixelColor(int16_t x, int16_t y, OLEDDISPLAY_COLOR color) {
 
 void OLEDDisplay::clearPixel(int16_t x, int16_t y) {
   if (x >= 0 && x < this->width() && y >= 0 && y < this->height()) {
+    touchRegion(x, x, y >> 3, y >> 3);
     switch (color) {
       case BLACK:   buffer[x + (y >> 3) * this->width()] |=  (1 << (y & 7)); break;
       case WHITE:   buffer[x + (y >> 3) * this->width()] &= ~(1 << (y & 7)); break;
@@ -402,6 +527,8 @@ void OLEDDisplay::drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
 
   if (length <= 0) { return; }
 
+  touchRegion(x, x + length - 1, y >> 3, y >> 3);
+
   uint8_t * bufferPtr = buffer;
   bufferPtr += (y >> 3) * this->width();
   bufferPtr += x;
@@ -435,6 +562,7 @@ void OLEDDisplay::drawVerticalLine(int16_t x, int16_t y, int16_t length) {
 
   if (length <= 0) return;
 
+  touchRegion(x, x, y >> 3, (y + length - 1) >> 3);
 
   uint8_t yOffset = y & 7;
   uint8_t drawBit;
@@ -553,14 +681,249 @@ void OLEDDisplay::drawIco16x16(int16_t xMove, int16_t yMove, const uint8_t *ico,
   }
 }
 
-uint16_t OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth, bool utf8) {
+#define GLYPH_NOT_CACHED 0xFFFF
+#define NO_GLYPH 0xFFFF
+
+// Feeds a byte of UTF-8 to the decoder, returns true with the code point once
+// a char is complete. Stray continuation bytes are dropped.
+static bool decodeUtf8(OLEDDisplayUtf8Decoder &decoder, uint8_t ch, uint32_t &codePoint) {
+  if (ch < 0x80) {
+    decoder.pending = 0;
+    codePoint = ch;
+    return true;
+  }
+  if (ch < 0xC0) {
+    if (decoder.pending == 0)
+      return false;
+    decoder.codePoint = (decoder.codePoint << 6) | (ch & 0x3F);
+    if (--decoder.pending)
+      return false;
+    codePoint = decoder.codePoint;
+    return true;
+  }
+  // Lead byte, the number of leading ones is the length of the sequence
+  decoder.pending   = ch < 0xE0 ? 1 : ch < 0xF0 ? 2 : 3;
+  decoder.codePoint = ch & (0x3F >> decoder.pending);
+  return false;
+}
+
+uint16_t OLEDDisplay::findGlyph(uint32_t codePoint) {
+  // The last range that starts at or before the code point
+  const uint8_t *table = fontData + RANGE_TABLE_START;
+  uint8_t low  = 0;
+  uint8_t high = pgm_read_byte(fontData + RANGE_COUNT_POS);
+  while (low < high) {
+    uint8_t middle = (low + high) >> 1;
+    const uint8_t *range = table + middle * RANGE_BYTES;
+    uint32_t first = ((uint32_t) pgm_read_byte(range) << 16) | (pgm_read_byte(range + 1) << 8) | pgm_read_byte(range + 2);
+    if (first <= codePoint)
+      low = middle + 1;
+    else
+      high = middle;
+  }
+  if (low == 0)
+    return NO_GLYPH;
+
+  const uint8_t *range = table + (low - 1) * RANGE_BYTES;
+  uint32_t first = ((uint32_t) pgm_read_byte(range) << 16) | (pgm_read_byte(range + 1) << 8) | pgm_read_byte(range + 2);
+  if (codePoint - first >= pgm_read_byte(range + 3))
+    return NO_GLYPH;
+  return ((pgm_read_byte(range + 4) << 8) | pgm_read_byte(range + 5)) + (codePoint - first);
+}
+
+// The font table code DefaultFontTableLookup() converts a code point to,
+// Latin-1 and the Euro sign at 0x80. 0 if there is none.
+static inline uint8_t latin1Code(uint32_t codePoint) {
+  if (codePoint < 256)
+    return codePoint;
+  return codePoint == 0x20AC ? 0x80 : 0;
+}
+
+bool OLEDDisplay::decodeChar(uint8_t ch, bool utf8, bool ranged, OLEDDisplayUtf8Decoder &decoder, uint32_t &code) {
+  code = ch;
+  if (!utf8)
+    return true;
+  if (ranged)
+    return decodeUtf8(decoder, ch, code);
+  if (this->fontTableLookupFunction != DefaultFontTableLookup) {
+    code = (uint8_t) (this->fontTableLookupFunction)(ch);
+    return code != 0;
+  }
+  // The default lookup, inlined and with its state in the caller's decoder
+  if (!decodeUtf8(decoder, ch, code))
+    return false;
+  code = latin1Code(code);
+  return code != 0;
+}
+
+uint16_t OLEDDisplay::glyphIndex(uint8_t ch, bool utf8, OLEDDisplayUtf8Decoder &decoder) {
+  uint32_t code;
+  if (!decodeChar(ch, utf8, fontFlags & FONT_RANGES, decoder, code))
+    return NO_GLYPH;
+  if (fontFlags & FONT_RANGES)
+    return findGlyph(code);
+  if (code < fontFirstChar || code - fontFirstChar >= fontChars)
+    return NO_GLYPH;
+  return code - fontFirstChar;
+}
+
+void OLEDDisplay::getGlyphMetrics(uint16_t index, uint16_t dataStart, OLEDDisplayGlyphMetrics &metrics) {
+  OLEDDisplayGlyphMetrics *cached = NULL;
+  if (index < glyphCacheChars) {
+    cached = &glyphCache[index];
+    if (cached->dataPosition != GLYPH_NOT_CACHED) {
+      metrics = *cached;
+      return;
+    }
+  }
+
+  // 4 Bytes per char code
+  const uint8_t *jump = fontData + fontJumpTable + index * JUMPTABLE_BYTES;
+  uint8_t msbJumpToChar = pgm_read_byte(jump);                  // MSB  \ JumpAddress
+  uint8_t lsbJumpToChar = pgm_read_byte(jump + JUMPTABLE_LSB);  // LSB /
+  // Chars with jump address 0xFFFF only advance the cursor
+  metrics.dataPosition = (msbJumpToChar == 255 && lsbJumpToChar == 255) ? 0 :
+                         dataStart + ((msbJumpToChar << 8) + lsbJumpToChar);
+  metrics.byteSize     = pgm_read_byte(jump + JUMPTABLE_SIZE);
+  metrics.width        = pgm_read_byte(jump + JUMPTABLE_WIDTH);
+  if (cached) *cached = metrics;
+}
+
+uint8_t OLEDDisplay::getGlyphWidth(uint16_t index) {
+  if (index < glyphCacheChars) {
+    if (glyphCache[index].dataPosition != GLYPH_NOT_CACHED) return glyphCache[index].width;
+    OLEDDisplayGlyphMetrics metrics;
+    getGlyphMetrics(index, fontDataStart(), metrics);
+    return metrics.width;
+  }
+  return pgm_read_byte(fontData + fontJumpTable + index * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+}
+
+// Decodes a FONT_BITPACKED glyph column by column. The bits are read into an
+// accumulator a byte at a time and come out as the raster bytes of the
+// column, which land in the buffer like those of blitRaster().
+template <OLEDDISPLAY_COLOR C>
+static void blitPackedGlyph(uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                            int16_t xMove, int16_t yMove, const uint8_t *glyph) {
+  uint8_t columns = pgm_read_byte(glyph);
+  uint8_t rows    = pgm_read_byte(glyph + 2);
+  yMove += pgm_read_byte(glyph + 1);
+  if (yMove + rows <= 0 || yMove >= displayPages * 8) return;
+
+  int16_t firstPage = yMove >> 3;
+  uint8_t shift     = yMove & 7;
+  int16_t c0        = xMove < 0 ? -xMove : 0;
+  int32_t c1        = (int32_t) displayWidth - xMove;
+  if (c1 > columns) c1 = columns;
+  if (c1 <= c0) return;
+
+  // Columns left of the display are skipped without decoding them
+  uint32_t bit = (uint32_t) c0 * rows;
+  const uint8_t *src = glyph + 3 + (bit >> 3);
+  uint16_t acc     = 0;
+  uint8_t  accBits = 0;
+  if (bit & 7) {
+    acc     = pgm_read_byte(src++) >> (bit & 7);
+    accBits = 8 - (bit & 7);
+  }
+
+  for (int16_t c = c0; c < c1; c++) {
+    uint8_t *column = buffer + xMove + c;
+    int16_t page = firstPage;
+    for (uint8_t r = 0; r < rows; r += 8, page++) {
+      uint8_t n = rows - r < 8 ? rows - r : 8;
+      if (accBits < n) {
+        acc |= (uint16_t) pgm_read_byte(src++) << accBits;
+        accBits += 8;
+      }
+      uint8_t bits = acc & ((1 << n) - 1);
+      acc >>= n;
+      accBits -= n;
+
+      if (page >= 0 && page < displayPages)
+        oledDisplayBlitByte<C>(column + page * displayWidth, bits << shift);
+      if (shift != 0 && page + 1 >= 0 && page + 1 < displayPages)
+        oledDisplayBlitByte<C>(column + (page + 1) * displayWidth, bits >> (8 - shift));
+    }
+  }
+}
+
+void OLEDDisplay::drawPackedGlyph(int16_t xMove, int16_t yMove, const uint8_t *glyph) {
+  // Only the box of the glyph's ink is drawn
+  int16_t lastColumn = xMove + pgm_read_byte(glyph) - 1;
+  int16_t firstRow   = yMove + pgm_read_byte(glyph + 1);
+  int16_t lastRow    = firstRow + pgm_read_byte(glyph + 2) - 1;
+  if (lastColumn < 0 || xMove >= this->width() || lastRow < 0 || firstRow >= this->height() || lastRow < firstRow)
+    return;
+  touchRegion(xMove < 0 ? 0 : xMove, lastColumn < this->width() ? lastColumn : this->width() - 1,
+              firstRow < 0 ? 0 : firstRow >> 3, lastRow < this->height() ? lastRow >> 3 : (this->height() - 1) >> 3);
+
+  uint16_t displayPages = displayBufferSize / this->width();
+  switch (this->color) {
+    case WHITE:
+      blitPackedGlyph<WHITE>(buffer, this->width(), displayPages, xMove, yMove, glyph);
+      break;
+    case BLACK:
+      blitPackedGlyph<BLACK>(buffer, this->width(), displayPages, xMove, yMove, glyph);
+      break;
+    case INVERSE:
+      blitPackedGlyph<INVERSE>(buffer, this->width(), displayPages, xMove, yMove, glyph);
+      break;
+  }
+#ifndef __MBED__
+  yield();
+#endif
+}
+
+uint8_t OLEDDisplay::layoutGlyphs(const char* text, uint16_t textLength, bool utf8, uint16_t &position, uint16_t &width,
+                                  OLEDDisplayGlyph *glyphs, uint8_t maxGlyphs, uint16_t maxWidth) {
+  uint16_t dataStart       = fontDataStart();
+  uint8_t count            = 0;
+  // Runs end after complete chars, so every run starts with a fresh decoder
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
+
+  for (; position < textLength; position++) {
+    // Checked before the lookup, which may keep state between chars
+    if ((glyphs && count == maxGlyphs) || width > maxWidth)
+      break;
+
+    uint16_t index = glyphIndex(text[position], utf8, decoder);
+    if (index == NO_GLYPH)
+      continue;
+
+    if (!glyphs) {
+      width += getGlyphWidth(index);
+      continue;
+    }
+
+    OLEDDisplayGlyphMetrics metrics;
+    getGlyphMetrics(index, dataStart, metrics);
+    width += metrics.width;
+
+    OLEDDisplayGlyph &glyph = glyphs[count++];
+    glyph.dataPosition = metrics.dataPosition;
+    glyph.textPosition = position;
+    glyph.byteSize     = metrics.byteSize;
+    glyph.width        = metrics.width;
+  }
+  return count;
+}
+
+uint16_t OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, bool utf8) {
   uint8_t textHeight       = pgm_read_byte(fontData + HEIGHT_POS);
-  uint8_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t sizeOfJumpTable = pgm_read_byte(fontData + CHAR_NUM_POS)  * JUMPTABLE_BYTES;
 
-  uint16_t cursorX         = 0;
-  uint16_t cursorY         = 0;
-  uint16_t charCount       = 0;
+  // Every char is decoded once, the width of the line is known after the first
+  // run unless the line is longer than that. Left aligned text that starts on
+  // the screen is only laid out up to the right edge.
+  OLEDDisplayGlyph glyphs[OLEDDISPLAY_GLYPH_RUN_LENGTH];
+  uint16_t maxWidth        = (textAlignment == TEXT_ALIGN_LEFT && xMove >= 0 && xMove < this->width()) ? this->width() - xMove : 0xFFFF;
+  uint16_t position        = 0;
+  uint16_t textWidth       = 0;
+  uint8_t count            = layoutGlyphs(text, textLength, utf8, position, textWidth, glyphs, OLEDDISPLAY_GLYPH_RUN_LENGTH, maxWidth);
+  if (position < textLength && (textAlignment != TEXT_ALIGN_LEFT || xMove < 0)) {
+    uint16_t rest = position;
+    layoutGlyphs(text, textLength, utf8, rest, textWidth);
+  }
 
   switch (textAlignment) {
     case TEXT_ALIGN_CENTER_BOTH:
@@ -580,52 +943,41 @@ uint16_t OLEDDisplay::drawStringInternal(int16_t xMove, int16_t yMove, const cha
   if (xMove + textWidth  < 0 || xMove >= this->width() ) {return 0;}
   if (yMove + textHeight < 0 || yMove >= this->height()) {return 0;}
 
-  for (uint16_t j = 0; j < textLength; j++) {
-    int16_t xPos = xMove + cursorX;
-    int16_t yPos = yMove + cursorY;
-    if (xPos > this->width())
-      break; // no need to continue
-    charCount++;
-
-    uint8_t code;
-    if (utf8) {
-      code = (this->fontTableLookupFunction)(text[j]);
-      if (code == 0)
-        continue;
-    } else
-      code = text[j];
-    if (code >= firstChar) {
-      uint8_t charCode = code - firstChar;
-
-      // 4 Bytes per char code
-      uint8_t msbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES );                  // MSB  \ JumpAddress
-      uint8_t lsbJumpToChar    = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_LSB);   // LSB /
-      uint8_t charByteSize     = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_SIZE);  // Size
-      uint8_t currentCharWidth = pgm_read_byte( fontData + JUMPTABLE_START + charCode * JUMPTABLE_BYTES + JUMPTABLE_WIDTH); // Width
-
-      // Test if the char is drawable
-      if (!(msbJumpToChar == 255 && lsbJumpToChar == 255)) {
-        // Get the position of the char data
-        uint16_t charDataPosition = JUMPTABLE_START + sizeOfJumpTable + ((msbJumpToChar << 8) + lsbJumpToChar);
-        drawInternal(xPos, yPos, currentCharWidth, textHeight, fontData, charDataPosition, charByteSize);
+  int16_t xPos = xMove;
+  for (;;) {
+    for (uint8_t g = 0; g < count; g++) {
+      const OLEDDisplayGlyph &glyph = glyphs[g];
+      if (glyph.dataPosition && (fontFlags & FONT_BITPACKED)) {
+        drawPackedGlyph(xPos, yMove, fontData + glyph.dataPosition);
+      } else if (glyph.dataPosition) {
+        drawInternal(xPos, yMove, glyph.width, textHeight, fontData, glyph.dataPosition, glyph.byteSize);
       }
-
-      cursorX += currentCharWidth;
+      xPos += glyph.width;
+      // No need to continue, the chars up to this one count as drawn
+      if (xPos > this->width())
+        return glyph.textPosition + 1 < textLength ? glyph.textPosition + 1 : textLength;
     }
+    if (position >= textLength)
+      break;
+    count = layoutGlyphs(text, textLength, utf8, position, textWidth, glyphs, OLEDDISPLAY_GLYPH_RUN_LENGTH);
   }
-  return charCount;
+  return textLength;
 }
 
 
-uint16_t OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &strUser) {
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
-
-  // char* text must be freed!
-  char* text = strdup(strUser.c_str());
-  if (!text) {
-    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][drawString] Can't allocate char array.\n");
-    return 0;
+uint8_t OLEDDisplay::drawGlyph(int16_t xMove, int16_t yMove, uint16_t index) {
+  OLEDDisplayGlyphMetrics metrics;
+  getGlyphMetrics(index, fontDataStart(), metrics);
+  if (metrics.dataPosition && (fontFlags & FONT_BITPACKED)) {
+    drawPackedGlyph(xMove, yMove, fontData + metrics.dataPosition);
+  } else if (metrics.dataPosition) {
+    drawInternal(xMove, yMove, metrics.width, pgm_read_byte(fontData + HEIGHT_POS), fontData, metrics.dataPosition, metrics.byteSize);
   }
+  return metrics.width;
+}
+
+uint16_t OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const char *text) {
+  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
 
   uint16_t yOffset = 0;
   // If the string should be centered vertically too
@@ -640,17 +992,121 @@ uint16_t OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &str
     yOffset = (lb * lineHeight) / 2;
   }
 
+  // Every line is drawn straight from text, empty lines are skipped
+  uint16_t charDrawn = 0;
+  uint16_t line = 0;
+  while (*text) {
+    uint16_t length = strcspn(text, "\n");
+    if (length) {
+      charDrawn += drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, text, length, true);
+    }
+    text += length;
+    if (*text) text++;
+  }
+  return charDrawn;
+}
+
+uint16_t OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const String &strUser) {
+  return drawString(xMove, yMove, strUser.c_str());
+}
+
+#ifndef __MBED__
+// Copies up to OLEDDISPLAY_FLASH_LINE_LENGTH of the next length bytes of a
+// flash string to chunk, without splitting a UTF-8 sequence
+static uint16_t copyFlashChunk(PGM_P text, uint16_t length, char *chunk) {
+  uint16_t n = length < OLEDDISPLAY_FLASH_LINE_LENGTH ? length : OLEDDISPLAY_FLASH_LINE_LENGTH;
+  if (n < length) {
+    while (n > 1 && (pgm_read_byte(text + n) & 0xC0) == 0x80) n--;
+  }
+  for (uint16_t i = 0; i < n; i++) {
+    chunk[i] = pgm_read_byte(text + i);
+  }
+  return n;
+}
+
+uint16_t OLEDDisplay::drawString(int16_t xMove, int16_t yMove, const __FlashStringHelper *strUser) {
+  PGM_P text = reinterpret_cast<PGM_P>(strUser);
+  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+
+  uint16_t yOffset = 0;
+  if (textAlignment == TEXT_ALIGN_CENTER_BOTH) {
+    uint16_t lb = 0;
+    char c;
+    for (uint16_t i = 0; (c = pgm_read_byte(text + i)) != 0; i++) {
+      lb += (c == 10);
+    }
+    yOffset = (lb * lineHeight) / 2;
+  }
+
+  // The lines are copied to the stack one at a time, the font code reads the
+  // text with plain loads. Longer lines are drawn a chunk at a time, left
+  // aligned from where the previous chunk ended.
+  char chunk[OLEDDISPLAY_FLASH_LINE_LENGTH];
   uint16_t charDrawn = 0;
   uint16_t line = 0;
-  char* textPart = strtok(text,"\n");
-  while (textPart != NULL) {
-    uint16_t length = strlen(textPart);
-    charDrawn += drawStringInternal(xMove, yMove - yOffset + (line++) * lineHeight, textPart, length, getStringWidth(textPart, length, true), true);
-    textPart = strtok(NULL, "\n");
+  for (;;) {
+    uint16_t length = 0;
+    char c;
+    while ((c = pgm_read_byte(text + length)) != 0 && c != 10) {
+      length++;
+    }
+    if (length) {
+      int16_t y = yMove - yOffset + (line++) * lineHeight;
+      if (length <= sizeof(chunk)) {
+        copyFlashChunk(text, length, chunk);
+        charDrawn += drawStringInternal(xMove, y, chunk, length, true);
+      } else {
+        charDrawn += drawFlashLine(xMove, y, text, length, chunk);
+      }
+    }
+    if (!c) break;
+    text += length + 1;
+  }
+  return charDrawn;
+}
+
+uint16_t OLEDDisplay::drawFlashLine(int16_t xMove, int16_t yMove, PGM_P text, uint16_t length, char *chunk) {
+  uint16_t textWidth = 0;
+  for (uint16_t position = 0; position < length; ) {
+    uint16_t n = copyFlashChunk(text + position, length - position, chunk);
+    textWidth += getStringWidth(chunk, n, true);
+    position += n;
+  }
+  switch (textAlignment) {
+    case TEXT_ALIGN_CENTER_BOTH:
+      yMove -= pgm_read_byte(fontData + HEIGHT_POS) >> 1;
+    // Fallthrough
+    case TEXT_ALIGN_CENTER:
+      xMove -= textWidth >> 1;
+      break;
+    case TEXT_ALIGN_RIGHT:
+      xMove -= textWidth;
+      break;
+    case TEXT_ALIGN_LEFT:
+      break;
+  }
+
+  // Don't draw anything if it is not on the screen.
+  if (xMove + textWidth < 0 || xMove >= this->width()) {return 0;}
+  if (yMove + pgm_read_byte(fontData + HEIGHT_POS) < 0 || yMove >= this->height()) {return 0;}
+
+  // Like for a whole line, the chars left of the screen count as drawn
+  OLEDDISPLAY_TEXT_ALIGNMENT alignment = textAlignment;
+  textAlignment = TEXT_ALIGN_LEFT;
+  uint16_t charDrawn = 0;
+  for (uint16_t position = 0; position < length; ) {
+    uint16_t n = copyFlashChunk(text + position, length - position, chunk);
+    uint16_t chunkWidth = getStringWidth(chunk, n, true);
+    uint16_t drawn = xMove + chunkWidth < 0 ? n : drawStringInternal(xMove, yMove, chunk, n, true);
+    charDrawn += drawn;
+    if (drawn < n) break;
+    xMove += chunkWidth;
+    position += n;
   }
-  free(text);
+  textAlignment = alignment;
   return charDrawn;
 }
+#endif
 
 void OLEDDisplay::drawStringf( int16_t x, int16_t y, char* buffer, String format, ... )
 {
@@ -662,10 +1118,11 @@ void OLEDDisplay::drawStringf( int16_t x, int16_t y, char* buffer, String format
 }
 
 uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const String &strUser) {
-  uint16_t firstChar  = pgm_read_byte(fontData + FIRST_CHAR_POS);
-  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  return drawStringMaxWidth(xMove, yMove, maxLineWidth, strUser.c_str());
+}
 
-  const char* text = strUser.c_str();
+uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t maxLineWidth, const char *text) {
+  uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
 
   uint16_t length = strlen(text);
   uint16_t lastDrawnPos = 0;
@@ -676,12 +1133,16 @@ uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t
   uint16_t widthAtBreakpoint = 0;
   uint16_t firstLineChars = 0;
   uint16_t drawStringResult = 1; // later tested for 0 == error, so initialize to 1
+  uint16_t charStart = 0;        // First byte of the current UTF-8 sequence
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
 
   for (uint16_t i = 0; i < length; i++) {
-    char c = (this->fontTableLookupFunction)(text[i]);
-    if (c == 0)
+    if ((text[i] & 0xC0) != 0x80)
+      charStart = i;
+    uint16_t index = glyphIndex(text[i], true, decoder);
+    if (index == NO_GLYPH)
       continue;
-    strWidth += pgm_read_byte(fontData + JUMPTABLE_START + (c - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
+    strWidth += getGlyphWidth(index);
 
     // Always try to break on a space, dash or slash
     if (text[i] == ' ' || text[i]== '-' || text[i] == '/') {
@@ -691,10 +1152,11 @@ uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t
 
     if (strWidth >= maxLineWidth) {
       if (preferredBreakpoint == 0) {
-        preferredBreakpoint = i;
+        // Don't split a char between the lines
+        preferredBreakpoint = charStart;
         widthAtBreakpoint = strWidth;
       }
-      drawStringResult = drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , &text[lastDrawnPos], preferredBreakpoint - lastDrawnPos, widthAtBreakpoint, true);
+      drawStringResult = drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , &text[lastDrawnPos], preferredBreakpoint - lastDrawnPos, true);
       if (firstLineChars == 0)
         firstLineChars = preferredBreakpoint;
       lastDrawnPos = preferredBreakpoint;
@@ -710,7 +1172,7 @@ uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t
 
   // Draw last part if needed
   if (drawStringResult != 0 && lastDrawnPos < length) {
-    drawStringResult = drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , &text[lastDrawnPos], length - lastDrawnPos, getStringWidth(&text[lastDrawnPos], length - lastDrawnPos, true), true);
+    drawStringResult = drawStringInternal(xMove, yMove + (lineNumber++) * lineHeight , &text[lastDrawnPos], length - lastDrawnPos, true);
   }
 
   if (drawStringResult == 0 || (yMove + lineNumber * lineHeight) >= this->height()) // text did not fit on screen
@@ -719,28 +1181,27 @@ uint16_t OLEDDisplay::drawStringMaxWidth(int16_t xMove, int16_t yMove, uint16_t
 }
 
 uint16_t OLEDDisplay::getStringWidth(const char* text, uint16_t length, bool utf8) {
-  uint16_t firstChar        = pgm_read_byte(fontData + FIRST_CHAR_POS);
-
   uint16_t stringWidth = 0;
   uint16_t maxWidth = 0;
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
 
   for (uint16_t i = 0; i < length; i++) {
-    char c = text[i];
-    if (utf8) {
-      c = (this->fontTableLookupFunction)(c);
-      if (c == 0)
-        continue;
-    }
-    stringWidth += pgm_read_byte(fontData + JUMPTABLE_START + (c - firstChar) * JUMPTABLE_BYTES + JUMPTABLE_WIDTH);
-    if (c == 10) {
+    uint16_t index = glyphIndex(text[i], utf8, decoder);
+    if (text[i] == 10) {
       maxWidth = max(maxWidth, stringWidth);
       stringWidth = 0;
+    } else if (index != NO_GLYPH) {
+      stringWidth += getGlyphWidth(index);
     }
   }
 
   return max(maxWidth, stringWidth);
 }
 
+uint16_t OLEDDisplay::getStringWidth(const char *text) {
+  return getStringWidth(text, strlen(text));
+}
+
 uint16_t OLEDDisplay::getStringWidth(const String &strUser) {
   uint16_t width = getStringWidth(strUser.c_str(), strUser.length());
   return width;
@@ -751,15 +1212,291 @@ void OLEDDisplay::setTextAlignment(OLEDDISPLAY_TEXT_ALIGNMENT textAlignment) {
 }
 
 void OLEDDisplay::setFont(const uint8_t *fontData) {
+  bool changed = fontData != this->fontData;
   this->fontData = fontData;
+  readFontHeader();
+  // The cache holds the metrics of one font, the new one's are read from
+  // flash as they are used
+  if (glyphCache && changed) setGlyphCache(true);
   // New font, so must recalculate. Whatever was there is gone at next print.
   setLogBuffer();
 }
 
+void OLEDDisplay::readFontHeader() {
+  fontFlags     = 0;
+  fontFirstChar = 0;
+  fontChars     = 0;
+  fontJumpTable = JUMPTABLE_START;
+  if (!fontData)
+    return;
+
+  if (pgm_read_byte(fontData + WIDTH_POS) == EXTENDED_FONT_MARKER) {
+    fontFlags     = pgm_read_byte(fontData + FONT_FLAGS_POS);
+    fontJumpTable = EXTENDED_JUMPTABLE_START;
+  }
+  if (fontFlags & FONT_RANGES) {
+    // The glyphs of the last range end the jump table
+    uint8_t ranges = pgm_read_byte(fontData + RANGE_COUNT_POS);
+    fontJumpTable  = RANGE_TABLE_START + ranges * RANGE_BYTES;
+    if (ranges) {
+      const uint8_t *last = fontData + fontJumpTable - RANGE_BYTES;
+      fontChars = ((pgm_read_byte(last + 4) << 8) | pgm_read_byte(last + 5)) + pgm_read_byte(last + 3);
+    }
+  } else {
+    fontFirstChar = pgm_read_byte(fontData + FIRST_CHAR_POS);
+    fontChars     = pgm_read_byte(fontData + CHAR_NUM_POS);
+  }
+}
+
 void OLEDDisplay::setFont(const char *fontData) {
   setFont(static_cast<const uint8_t*>(reinterpret_cast<const void*>(fontData)));
 }
 
+// Free heap in bytes, as far as the platform reports it
+static uint32_t freeHeap() {
+#if defined(ESP8266) || defined(ESP32)
+  return ESP.getFreeHeap();
+#else
+  return UINT32_MAX;
+#endif
+}
+
+bool OLEDDisplay::setGlyphCache(bool enabled) {
+  if (!enabled) {
+    free(glyphCache);
+    glyphCache = NULL;
+    glyphCacheChars = 0;
+    return true;
+  }
+
+  if (!glyphCache) {
+    uint16_t size = OLEDDISPLAY_GLYPH_CACHE_CHARS * sizeof(OLEDDisplayGlyphMetrics);
+    if (freeHeap() < (uint32_t) size + OLEDDISPLAY_GLYPH_CACHE_MIN_HEAP) {
+      DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setGlyphCache] Not enough heap for the glyph cache\n");
+      return false;
+    }
+    glyphCache = (OLEDDisplayGlyphMetrics*) malloc(size);
+    if (!glyphCache) {
+      return false;
+    }
+  } else if (freeHeap() < OLEDDISPLAY_GLYPH_CACHE_MIN_HEAP) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setGlyphCache] Heap is low, turning the glyph cache off\n");
+    setGlyphCache(false);
+    return false;
+  }
+
+  // Nothing is cached for the current font yet
+  glyphCacheChars = fontChars < OLEDDISPLAY_GLYPH_CACHE_CHARS ? fontChars : OLEDDISPLAY_GLYPH_CACHE_CHARS;
+  for (uint8_t i = 0; i < glyphCacheChars; i++) {
+    glyphCache[i].dataPosition = GLYPH_NOT_CACHED;
+  }
+  return true;
+}
+
+uint16_t OLEDDisplay::getGlyphCacheSize(void) {
+  return glyphCache ? OLEDDISPLAY_GLYPH_CACHE_CHARS * sizeof(OLEDDisplayGlyphMetrics) : 0;
+}
+
+// Replaces the bits of mask in a byte of the buffer, the glyph pixels
+// (bits) get the color and the others the background
+template <OLEDDISPLAY_COLOR C>
+static inline void fillByte(uint8_t *dst, uint8_t bits, uint8_t mask) {
+  if (C == WHITE)      *dst = (*dst & ~mask) | bits;
+  else if (C == BLACK) *dst = (*dst | mask) & ~bits;
+  else                 *dst ^= bits;
+}
+
+// Draws width columns of a bitmap in the page layout of the buffer (pages rows,
+// stride bytes apart) at xMove/yMove. Unlike raster data, every row is a run of
+// consecutive bytes, so page aligned rows are combined with the buffer (or, if
+// opaque, copied) in one go.
+template <OLEDDISPLAY_COLOR C>
+static void blitPages(uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                      int16_t xMove, int16_t yMove, const uint8_t *data, uint16_t stride,
+                      uint16_t width, uint8_t pages, bool opaque) {
+  int16_t firstPage = yMove >> 3;
+  uint8_t shift     = yMove & 7;
+  int16_t x0        = xMove < 0 ? 0 : xMove;
+  int32_t x1        = (int32_t) xMove + width;
+  if (x1 > displayWidth) x1 = displayWidth;
+  if (x1 <= x0) return;
+
+  uint16_t columns  = x1 - x0;
+  uint8_t upperMask = 0xFF << shift;
+  uint8_t lowerMask = ~upperMask;
+  data += x0 - xMove;
+
+  for (uint8_t r = 0; r < pages; r++, data += stride) {
+    int16_t upper = firstPage + r;
+    int16_t lower = upper + 1;
+    uint8_t *upperByte = buffer + upper * displayWidth + x0;
+    uint8_t *lowerByte = buffer + lower * displayWidth + x0;
+
+    if (upper >= 0 && upper < displayPages) {
+      if (shift == 0 && opaque && C == WHITE) {
+        memcpy(upperByte, data, columns);
+      } else if (shift == 0 && !opaque) {
+        for (uint16_t x = 0; x < columns; x++) oledDisplayBlitByte<C>(upperByte + x, data[x]);
+      } else if (opaque) {
+        for (uint16_t x = 0; x < columns; x++) fillByte<C>(upperByte + x, data[x] << shift, upperMask);
+      } else {
+        for (uint16_t x = 0; x < columns; x++) oledDisplayBlitByte<C>(upperByte + x, data[x] << shift);
+      }
+    }
+    if (shift != 0 && lower >= 0 && lower < displayPages) {
+      if (opaque) {
+        for (uint16_t x = 0; x < columns; x++) fillByte<C>(lowerByte + x, data[x] >> (8 - shift), lowerMask);
+      } else {
+        for (uint16_t x = 0; x < columns; x++) oledDisplayBlitByte<C>(lowerByte + x, data[x] >> (8 - shift));
+      }
+    }
+  }
+}
+
+static void blitPages(OLEDDISPLAY_COLOR color, uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                      int16_t xMove, int16_t yMove, const uint8_t *data, uint16_t stride,
+                      uint16_t width, uint8_t pages, bool opaque) {
+  switch (color) {
+    case WHITE:
+      blitPages<WHITE>(buffer, displayWidth, displayPages, xMove, yMove, data, stride, width, pages, opaque);
+      break;
+    case BLACK:
+      blitPages<BLACK>(buffer, displayWidth, displayPages, xMove, yMove, data, stride, width, pages, opaque);
+      break;
+    case INVERSE:
+      blitPages<INVERSE>(buffer, displayWidth, displayPages, xMove, yMove, data, stride, width, pages, opaque);
+      break;
+  }
+}
+
+bool OLEDDisplay::createAtlas(OLEDDisplayAtlas &atlas, const char *charset) {
+  uint8_t textHeight = pgm_read_byte(fontData + HEIGHT_POS);
+  uint16_t dataStart = fontDataStart();
+
+  atlas.data   = NULL;
+  atlas.width  = 0;
+  atlas.pages  = 1 + ((textHeight - 1) >> 3);
+  atlas.height = textHeight;
+  atlas.chars  = 0;
+  atlas.ranged = fontFlags & FONT_RANGES;
+
+  OLEDDisplayGlyphMetrics metrics[OLEDDISPLAY_ATLAS_CHARS];
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
+  for (; *charset; charset++) {
+    uint32_t code;
+    if (!decodeChar(*charset, true, atlas.ranged, decoder, code))
+      continue;
+    uint16_t index = atlas.ranged ? findGlyph(code) : code - fontFirstChar;
+    if (atlas.ranged ? index == NO_GLYPH : code < fontFirstChar || index >= fontChars)
+      continue;
+    bool known = false;
+    for (uint8_t i = 0; i < atlas.chars; i++) {
+      known |= atlas.codes[i] == code;
+    }
+    if (known)
+      continue;
+    if (atlas.chars == OLEDDISPLAY_ATLAS_CHARS) {
+      DEBUG_OLEDDISPLAY("[OLEDDISPLAY][createAtlas] Too many chars\n");
+      return false;
+    }
+
+    OLEDDisplayGlyphMetrics &glyph = metrics[atlas.chars];
+    getGlyphMetrics(index, dataStart, glyph);
+    // A cell as wide as the raster, which may be wider than the advance
+    uint16_t rasterWidth = 0;
+    if (glyph.dataPosition && (fontFlags & FONT_BITPACKED))
+      rasterWidth = pgm_read_byte(fontData + glyph.dataPosition);
+    else if (glyph.dataPosition)
+      rasterWidth = (glyph.byteSize + atlas.pages - 1) / atlas.pages;
+    atlas.codes[atlas.chars]   = code;
+    atlas.advance[atlas.chars] = glyph.width;
+    atlas.column[atlas.chars]  = atlas.width;
+    atlas.width += rasterWidth > glyph.width ? rasterWidth : glyph.width;
+    atlas.chars++;
+  }
+  atlas.column[atlas.chars] = atlas.width;
+  if (atlas.width == 0)
+    return true;
+
+  uint16_t size = atlas.width * atlas.pages;
+  atlas.data = (uint8_t*) malloc(size);
+  if (!atlas.data) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][createAtlas] Not enough memory to create the atlas\n");
+    return false;
+  }
+  memset(atlas.data, 0, size);
+  for (uint8_t i = 0; i < atlas.chars; i++) {
+    if (metrics[i].dataPosition && (fontFlags & FONT_BITPACKED)) {
+      blitPackedGlyph<WHITE>(atlas.data, atlas.width, atlas.pages, atlas.column[i], 0, fontData + metrics[i].dataPosition);
+    } else if (metrics[i].dataPosition) {
+      blitRaster<WHITE>(atlas.data, atlas.width, atlas.pages, atlas.column[i], 0, atlas.pages,
+                        fontData + metrics[i].dataPosition, metrics[i].byteSize);
+    }
+  }
+  return true;
+}
+
+void OLEDDisplay::freeAtlas(OLEDDisplayAtlas &atlas) {
+  free(atlas.data);
+  atlas.data  = NULL;
+  atlas.width = 0;
+  atlas.chars = 0;
+}
+
+uint16_t OLEDDisplay::drawStringAtlas(int16_t xMove, int16_t yMove, const OLEDDisplayAtlas &atlas, const char *text, bool opaque) {
+  // The text is decoded once, the alignment needs its width before drawing
+  uint8_t glyphs[OLEDDISPLAY_GLYPH_RUN_LENGTH];
+  uint8_t count       = 0;
+  uint16_t textWidth  = 0;
+  uint16_t cellsWidth = 0;
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
+  for (; *text && count < OLEDDISPLAY_GLYPH_RUN_LENGTH; text++) {
+    uint32_t code;
+    if (!decodeChar(*text, true, atlas.ranged, decoder, code))
+      continue;
+    for (uint8_t i = 0; i < atlas.chars; i++) {
+      if (atlas.codes[i] == code) {
+        uint16_t cellEnd = textWidth + atlas.column[i + 1] - atlas.column[i];
+        if (cellEnd > cellsWidth) cellsWidth = cellEnd;
+        textWidth += atlas.advance[i];
+        glyphs[count++] = i;
+        break;
+      }
+    }
+  }
+
+  switch (textAlignment) {
+    case TEXT_ALIGN_CENTER_BOTH:
+      yMove -= atlas.height >> 1;
+    // Fallthrough
+    case TEXT_ALIGN_CENTER:
+      xMove -= textWidth >> 1;
+      break;
+    case TEXT_ALIGN_RIGHT:
+      xMove -= textWidth;
+      break;
+    case TEXT_ALIGN_LEFT:
+      break;
+  }
+
+  int16_t lastColumn = xMove + cellsWidth - 1;
+  int16_t lastRow    = yMove + atlas.pages * 8 - 1;
+  if (!atlas.data || lastColumn < 0 || xMove >= this->width() || lastRow < 0 || yMove >= this->height())
+    return textWidth;
+  touchRegion(xMove < 0 ? 0 : xMove, lastColumn < this->width() ? lastColumn : this->width() - 1,
+              yMove < 0 ? 0 : yMove >> 3, lastRow < this->height() ? lastRow >> 3 : (this->height() - 1) >> 3);
+
+  uint16_t displayPages = displayBufferSize / this->width();
+  int16_t xPos = xMove;
+  for (uint8_t g = 0; g < count; g++) {
+    uint8_t i = glyphs[g];
+    blitPages(this->color, buffer, this->width(), displayPages, xPos, yMove, atlas.data + atlas.column[i],
+              atlas.width, atlas.column[i + 1] - atlas.column[i], atlas.pages, opaque);
+    xPos += atlas.advance[i];
+  }
+  return textWidth;
+}
+
 void OLEDDisplay::displayOn(void) {
   sendCommand(DISPLAYON);
 }
@@ -820,48 +1557,337 @@ void OLEDDisplay::mirrorScreen() {
   sendCommand(COMSCANDEC);           //Mirror screen
 }
 
+void OLEDDisplay::scrollPages(int8_t pages) {
+  const uint16_t width = this->width();
+  const uint8_t screenPages = this->height() / 8;
+  const uint8_t distance = pages < 0 ? -pages : pages;
+  if (distance == 0)
+    return;
+  if (scrollActive)
+    stopScroll();
+  if (distance >= screenPages) {
+    clear();
+    return;
+  }
+
+  // The pages that stay on the screen move from from to to, the ones that
+  // come into view from exposed on are cleared
+  const uint8_t kept    = screenPages - distance;
+  const uint8_t from    = pages > 0 ? distance : 0;
+  const uint8_t to      = pages > 0 ? 0 : distance;
+  const uint8_t exposed = pages > 0 ? kept : 0;
+
+  // buffer_back is still in use by the running transfer
+  waitForTransfer();
+  memmove(buffer + to * width, buffer + from * width, kept * width);
+  memset(buffer + exposed * width, 0, distance * width);
+
+  if (screenPages > 8) {
+    // More rows than the display RAM of the controllers, it has to be sent
+    touchRegion(0, width - 1, 0, screenPages - 1);
+    return;
+  }
+
+  // The display RAM stays where it is, after the start line moved the
+  // display shows what the moved buffer_back holds
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  memmove(buffer_back + to * width, buffer_back + from * width, kept * width);
+#endif
+#ifdef OLEDDISPLAY_SEGMENT_HASHES
+  memmove(segmentHashes + to * segmentsPerPage, segmentHashes + from * segmentsPerPage, kept * segmentsPerPage * sizeof(uint32_t));
+#endif
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+  // Changes that were not sent yet move along, nothing is drawn on the cleared pages
+  memmove(pageStates + to, pageStates + from, kept * sizeof(OLEDDisplayPageState));
+  for (uint8_t page = exposed; page < exposed + distance; page++) {
+    pageStates[page].dirtyX0 = pageStates[page].inkX0 = UINT16_MAX;
+    pageStates[page].dirtyX1 = pageStates[page].inkX1 = 0;
+  }
+#endif
+
+  // The display RAM behind the exposed pages still shows what scrolled off
+  // (or was never visible), display() sends them whole
+  uint8_t stale = pages > 0 ? stalePages >> distance : stalePages << distance;
+  for (uint8_t page = exposed; page < exposed + distance; page++) {
+    stale |= 1 << page;
+  }
+  stalePages = stale;
+
+  startPage = (startPage + pages + 8) & 7;
+  startLinePending = true;
+}
+
+bool OLEDDisplay::startScroll(OLEDDISPLAY_SCROLL_DIRECTION direction, uint8_t page0, uint8_t page1,
+                              OLEDDISPLAY_SCROLL_INTERVAL interval) {
+  return startDiagonalScroll(direction, page0, page1, 0, interval);
+}
+
+bool OLEDDisplay::startDiagonalScroll(OLEDDISPLAY_SCROLL_DIRECTION direction, uint8_t page0, uint8_t page1,
+                                      uint8_t rowsPerStep, OLEDDISPLAY_SCROLL_INTERVAL interval,
+                                      uint8_t top, uint8_t rows) {
+  const uint16_t height = this->height();
+  const uint8_t screenPages = height / 8;
+  if (!supportsScrollEngine() || this->width() > 128 || screenPages > 8) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][startScroll] The display has no scroll engine\n");
+    return false;
+  }
+  if (rows == 0 && top < height) {
+    rows = height - top;
+  }
+  if (page0 > page1 || page1 >= screenPages || (rowsPerStep && (rows == 0 || top + rows > height || rowsPerStep >= rows))) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][startScroll] Invalid scroll area\n");
+    return false;
+  }
+
+  // The settings must not change while the engine runs
+  if (scrollActive) {
+    stopScroll();
+  }
+  // The engine takes pages of the display RAM, which are the pages of the
+  // buffer again once the start line is back at 0
+  if (startPage != 0) {
+    startPage = 0;
+    startLinePending = true;
+    stalePages = (1 << screenPages) - 1;
+  }
+  // It moves what the display shows
+  display();
+
+  // The bus is still set up by display()
+  if (rowsPerStep) {
+    const uint8_t commands[] = {
+      SET_VERTICAL_SCROLL_AREA, (uint8_t) top, (uint8_t) rows,
+      (uint8_t) (direction == SCROLL_LEFT ? VERTICAL_AND_LEFT_HORIZONTAL_SCROLL : VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL),
+      0x00, page0, (uint8_t) interval, page1, (uint8_t) rowsPerStep, ACTIVATE_SCROLL
+    };
+    sendCommands(commands, sizeof(commands));
+  } else {
+    const uint8_t commands[] = {
+      (uint8_t) (direction == SCROLL_LEFT ? LEFT_HORIZONTAL_SCROLL : RIGHT_HORIZONTAL_SCROLL),
+      0x00, page0, (uint8_t) interval, page1, 0x00, 0xFF, ACTIVATE_SCROLL
+    };
+    sendCommands(commands, sizeof(commands));
+  }
+
+  scrollActive = true;
+  scrollColumnPage0 = scrollPage0 = page0;
+  scrollColumnPage1 = scrollPage1 = page1;
+  if (rowsPerStep) {
+    if (top / 8 < scrollPage0) scrollPage0 = top / 8;
+    if ((top + rows - 1) / 8 > scrollPage1) scrollPage1 = (top + rows - 1) / 8;
+  }
+  scrollDirection = direction;
+  scrollInterval = interval;
+  scrollRowsPerStep = rowsPerStep;
+  scrollTop = top;
+  scrollRows = rows;
+  scrollStart = oled_millis();
+  return true;
+}
+
+void OLEDDisplay::stopScroll(OLEDDISPLAY_SCROLL_SYNC sync) {
+  if (!scrollActive) return;
+  stopScrollAfter(sync == SCROLL_SYNC_BUFFER ? getScrollSteps() : 0);
+}
+
+void OLEDDisplay::stopScrollAfter(uint32_t steps) {
+  if (!scrollActive) return;
+  sendCommand(DEACTIVATE_SCROLL);
+  scrollActive = false;
+  moveScrolledContent(steps);
+
+  // The display RAM of the pages is wherever the engine left it
+  for (uint8_t page = scrollPage0; page <= scrollPage1; page++) {
+    stalePages |= 1 << page;
+  }
+  display();
+}
+
+bool OLEDDisplay::isScrolling(void) {
+  return scrollActive;
+}
+
+// Frames per step of OLEDDISPLAY_SCROLL_INTERVAL
+static const uint16_t scrollIntervalFrames[] = { 5, 64, 128, 256, 3, 4, 25, 2 };
+
+uint32_t OLEDDisplay::getScrollSteps(void) {
+  if (!scrollActive) return 0;
+  // The frame rate depends on the number of rows the controller drives
+  uint64_t frames = (uint64_t) (oled_millis() - scrollStart) * OLEDDISPLAY_FRAME_RATE * 64 / this->height() / 1000;
+  return frames / scrollIntervalFrames[scrollInterval];
+}
+
+void OLEDDisplay::moveScrolledContent(uint32_t steps) {
+  const uint16_t width = this->width();
+  const uint8_t screenPages = this->height() / 8;
+  if (steps == 0) return;
+
+  // The engine rotates all 128 columns of the display RAM, narrower displays
+  // show the ones in the middle. Columns nothing was drawn to are empty.
+  const uint8_t offset = (128 - width) / 2;
+  const uint8_t columns = steps & 127;
+  if (columns) {
+    uint8_t row[128];
+    for (uint8_t page = scrollColumnPage0; page <= scrollColumnPage1; page++) {
+      uint8_t *line = &buffer[page * width];
+      memcpy(row, line, width);
+      for (uint16_t x = 0; x < width; x++) {
+        // Column of the display RAM whose content moved to x
+        uint8_t source = (offset + x + (scrollDirection == SCROLL_RIGHT ? 128 - columns : columns)) & 127;
+        line[x] = source >= offset && source < offset + width ? row[source - offset] : 0;
+      }
+    }
+  }
+
+  // Row top + i of the scroll area now shows what was row top + (i + shift) % rows
+  const uint8_t shift = scrollRowsPerStep ? (uint64_t) steps * scrollRowsPerStep % scrollRows : 0;
+  if (shift) {
+    const uint64_t mask = scrollRows == 64 ? ~0ULL : (1ULL << scrollRows) - 1;
+    for (uint16_t x = 0; x < width; x++) {
+      uint64_t column = 0;
+      for (uint8_t page = 0; page < screenPages; page++) {
+        column |= (uint64_t) buffer[page * width + x] << (page * 8);
+      }
+      uint64_t area = (column >> scrollTop) & mask;
+      area = ((area >> shift) | (area << (scrollRows - shift))) & mask;
+      column = (column & ~(mask << scrollTop)) | (area << scrollTop);
+      for (uint8_t page = 0; page < screenPages; page++) {
+        buffer[page * width + x] = column >> (page * 8);
+      }
+    }
+  }
+  touchRegion(0, width - 1, scrollPage0, scrollPage1);
+}
+
 void OLEDDisplay::clear(void) {
   memset(buffer, 0, displayBufferSize);
+  logBufferDrawn = false;
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+  // Only what was drawn since the last clear() can differ from an empty screen
+  for (uint8_t page = 0; page < this->height() / 8; page++) {
+    OLEDDisplayPageState &state = pageStates[page];
+    if (state.inkX0 <= state.inkX1) {
+      if (state.inkX0 < state.dirtyX0) state.dirtyX0 = state.inkX0;
+      if (state.inkX1 > state.dirtyX1) state.dirtyX1 = state.inkX1;
+    }
+    state.inkX0 = UINT16_MAX;
+    state.inkX1 = 0;
+  }
+#endif
 }
 
 void OLEDDisplay::drawLogBuffer(uint16_t xMove, uint16_t yMove) {
+  (void)xMove; (void)yMove;
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_SERIAL)
   Serial.println("[deprecated] Print functionality now handles buffer management automatically. This is a no-op.");
 #endif
 }
 
-void OLEDDisplay::drawLogBuffer() {
+uint16_t OLEDDisplay::logLineHeight() {
   uint16_t lineHeight = pgm_read_byte(fontData + HEIGHT_POS);
+#ifdef OLEDDISPLAY_LOG_PAGE_LINES
+  // Whole pages, so scrollLogBuffer() can move the screen with scrollPages()
+  lineHeight = (lineHeight + 7) & ~7;
+#endif
+  return lineHeight;
+}
+
+uint16_t OLEDDisplay::logBufferShift() {
+  uint16_t lineHeight = logLineHeight();
+  return (this->logBufferLine == this->logBufferMaxLines) ? (lineHeight - (displayHeight % lineHeight)) % lineHeight : 0;
+}
+
+void OLEDDisplay::drawLogBuffer(int16_t top) {
+  uint16_t lineHeight = logLineHeight();
+  bool utf8 = fontFlags & FONT_RANGES;
   // Always align left
   setTextAlignment(TEXT_ALIGN_LEFT);
 
-  // State values
-  uint16_t length   = 0;
-  uint16_t line     = 0;
-  uint16_t lastPos  = 0;
-
-  // If the lineHeight and the display height are not cleanly divisible, we need
-  // to start off the screen when the buffer has logBufferMaxLines so that the
-  // first line, and not the last line, drops off.
-  uint16_t shiftUp = (this->logBufferLine == this->logBufferMaxLines) ? (lineHeight - (displayHeight % lineHeight)) % lineHeight : 0;
-
-  for (uint16_t i=0;i<this->logBufferFilled;i++){
-    length++;
-    // Everytime we have a \n print
-    if (this->logBuffer[i] == 10) {
-      // Draw string on line `line` from lastPos to length
-      // Passing 0 as the lenght because we are in TEXT_ALIGN_LEFT
-      drawStringInternal(0, 0 - shiftUp + (line++) * lineHeight, &this->logBuffer[lastPos], length, 0, false);
-      // Remember last pos
-      lastPos = i;
-      // Reset length
-      length = 0;
+  // Skip the lines above top
+  int16_t  y    = -logBufferShift();
+  uint16_t line = 0;
+  while (line < this->logBufferLine && y + lineHeight <= top) {
+    line++;
+    y += lineHeight;
+  }
+  if (top > 0)
+    clearRows(y > 0 ? y : 0);
+
+  uint16_t end = (this->logBufferStart + this->logBufferFilled) % this->logBufferSize;
+  for (; line <= this->logBufferLine && y < this->height(); line++, y += lineHeight) {
+    // Every line but the last one ends with a line break, which is not drawn
+    uint16_t start  = logLineStart(line);
+    uint16_t next   = line < this->logBufferLine ? logLineStart(line + 1) : end;
+    uint16_t length = (next + this->logBufferSize - start) % this->logBufferSize - (line < this->logBufferLine ? 1 : 0);
+
+    const char *text = &this->logBuffer[start];
+    if (start + length > this->logBufferSize) {
+      // The line wraps around the end of the ring
+      uint16_t head = this->logBufferSize - start;
+      memcpy(this->logLineCopy, text, head);
+      memcpy(this->logLineCopy + head, this->logBuffer, length - head);
+      text = this->logLineCopy;
     }
+    drawStringInternal(0, y, text, length, utf8);
   }
-  // Draw the remaining string
-  if (length > 0) {
-    drawStringInternal(0, 0 - shiftUp + line * lineHeight, &this->logBuffer[lastPos], length, 0, false);
+}
+
+void OLEDDisplay::scrollLogBuffer(uint16_t rows) {
+  if (rows >= this->height()) {
+    clear();
+    drawLogBuffer();
+    return;
+  }
+  // Whole pages are moved by the display itself, always the case with
+  // OLEDDISPLAY_LOG_PAGE_LINES or a font height that is a multiple of 8
+  if (rows & 7)
+    shiftBufferUp(rows);
+  else
+    scrollPages(rows >> 3);
+  drawLogBuffer(this->height() - rows);
+}
+
+void OLEDDisplay::shiftBufferUp(uint16_t rows) {
+  uint16_t width = this->width();
+  uint16_t pages = displayBufferSize / width;
+  uint16_t skip  = rows >> 3;
+  uint8_t  shift = rows & 7;
+
+  // Every page is combined from the two pages rows further down, which
+  // have not been moved yet
+  for (uint16_t page = 0; page < pages; page++) {
+    uint8_t *dst = buffer + page * width;
+    if (page + skip >= pages) {
+      memset(dst, 0, width);
+    } else if (!shift) {
+      memmove(dst, buffer + (page + skip) * width, width);
+    } else if (page + skip + 1 >= pages) {
+      const uint8_t *src = buffer + (page + skip) * width;
+      for (uint16_t x = 0; x < width; x++)
+        dst[x] = src[x] >> shift;
+    } else {
+      const uint8_t *src = buffer + (page + skip) * width;
+      for (uint16_t x = 0; x < width; x++)
+        dst[x] = (src[x] >> shift) | (src[x + width] << (8 - shift));
+    }
   }
+  touchRegion(0, width - 1, 0, pages - 1);
+}
+
+void OLEDDisplay::clearRows(uint16_t row) {
+  uint16_t width = this->width();
+  uint16_t pages = displayBufferSize / width;
+  uint16_t page  = row >> 3;
+  if (page >= pages)
+    return;
+
+  // Keep the rows above row in its page
+  uint8_t keep = (1 << (row & 7)) - 1;
+  uint8_t *dst = buffer + page * width;
+  for (uint16_t x = 0; x < width; x++)
+    dst[x] &= keep;
+  memset(dst + width, 0, (pages - page - 1) * width);
+  touchRegion(0, width - 1, page, pages - 1);
 }
 
 uint16_t OLEDDisplay::getWidth(void) {
@@ -874,12 +1900,12 @@ uint16_t OLEDDisplay::getHeight(void) {
 
 void OLEDDisplay::cls() {
   clear();
-  this->logBufferFilled = 0;
-  this->logBufferLine = 0;
+  emptyLogBuffer();
   display();
 }
 
 bool OLEDDisplay::setLogBuffer(uint16_t lines, uint16_t chars) {
+  (void)lines; (void)chars;
 #if !defined(NO_GLOBAL_INSTANCES) && !defined(NO_GLOBAL_SERIAL)
   Serial.println("[deprecated] Print functionality now handles buffer management automatically. This is a no-op.");
 #endif
@@ -892,14 +1918,18 @@ bool OLEDDisplay::setLogBuffer(){
 		return false;
   
   // we're always starting over
-  if (logBuffer != NULL)
+  if (logBuffer != NULL) {
     free(logBuffer);
+    logBuffer = NULL;
+    logBufferSize = 0;
+  }
 
   // figure out how big it needs to be
   uint8_t textHeight = pgm_read_byte(fontData + HEIGHT_POS);
   if (!textHeight)
     return false;  // Prevent division by zero crashes
-  uint16_t lines =  this->displayHeight / textHeight + (this->displayHeight % textHeight ? 1 : 0);
+  uint16_t lineHeight = logLineHeight();
+  uint16_t lines =  this->displayHeight / lineHeight + (this->displayHeight % lineHeight ? 1 : 0);
   uint16_t chars =   5 * (this->displayWidth / textHeight);
   uint16_t size = lines * (chars + 1);  // +1 is for \n
 
@@ -907,21 +1937,36 @@ bool OLEDDisplay::setLogBuffer(){
   if (size == 0) 
     return false;
 
-  // All good, initialize logBuffer
-  this->logBufferLine     = 0;      // Lines printed
-  this->logBufferFilled   = 0;      // Nothing stored yet
-  this->logBufferMaxLines = lines;  // Lines max printable
-  this->logBufferLineLen  = chars;  // Chars per line
-  this->logBufferSize     = size;   // Total number of characters the buffer can hold
-  this->logBuffer         = (char *) malloc(size * sizeof(uint8_t));
+  // The ring, the copy of a line and the line starts in one allocation
+  uint16_t charBytes = (size + chars + 1) & ~1;
+  this->logBuffer = (char *) malloc(charBytes + (lines + 1) * sizeof(uint16_t));
   if(!this->logBuffer) {
     DEBUG_OLEDDISPLAY("[OLEDDISPLAY][setLogBuffer] Not enough memory to create log buffer\n");
     return false;
   }
 
+  // All good, initialize logBuffer
+  this->logLineCopy       = this->logBuffer + size;
+  this->logLineStarts     = (uint16_t *) (this->logBuffer + charBytes);
+  this->logBufferMaxLines = lines;  // Lines max printable
+  this->logBufferLineLen  = chars;  // Chars per line
+  this->logBufferSize     = size;   // Total number of characters the buffer can hold
+  emptyLogBuffer();
+
   return true;
 }
 
+void OLEDDisplay::emptyLogBuffer() {
+  this->logBufferStart   = 0;
+  this->logBufferFilled  = 0;      // Nothing stored yet
+  this->logBufferLine    = 0;      // Lines printed
+  this->logFirstLine     = 0;
+  this->logLastLineLen   = 0;
+  this->logLastLineWidth = 0;
+  this->logBufferDrawn   = false;
+  logDecoder.pending = 0;
+}
+
 size_t OLEDDisplay::write(uint8_t c) {
   if (!fontData)
 		return 1;
@@ -936,60 +1981,75 @@ size_t OLEDDisplay::write(uint8_t c) {
   // Don't waste space on \r\n line endings, dropping \r
   if (c == 13) return 1;
 
-  // convert UTF-8 character to font table index
-  c = (this->fontTableLookupFunction)(c);
-  // drop unknown character
-  if (c == 0) return 1;
+  // convert UTF-8 character to font table index, ranged fonts are drawn
+  // from UTF-8. The bytes of a char may come in separate calls.
+  if (!(fontFlags & FONT_RANGES)) {
+    uint32_t code;
+    // drop unknown character
+    if (!decodeChar(c, true, false, logDecoder, code)) return 1;
+    c = code;
+  }
+
+  // if last line is max length, ignore anything but linebreaks
+  if (this->logLastLineLen >= this->logBufferLineLen && c != 10) return 1;
 
-  bool maxLineReached = this->logBufferLine >= this->logBufferMaxLines;
-  bool bufferFull = this->logBufferFilled >= this->logBufferSize;
+  uint16_t lineHeight = logLineHeight();
+  uint16_t shift      = logBufferShift();
+  uint16_t scroll     = 0;
 
   // Can we write to the buffer? If not, make space.
-  if (bufferFull || maxLineReached) {
-    // See if we can chop off the first line
-    uint16_t firstLineEnd = 0;
-    for (uint16_t i = 0; i < this->logBufferFilled; i++) {
-      if (this->logBuffer[i] == 10){
-        // Include last char too
-        firstLineEnd = i + 1;
-        // Calculate the new logBufferFilled value
-        this->logBufferFilled = logBufferFilled - firstLineEnd;
-        // Now move other lines to front of the buffer
-        memcpy(this->logBuffer, &this->logBuffer[firstLineEnd], logBufferFilled);
-        // And voila, buffer one line shorter
-        this->logBufferLine--;
-        break;
-      }
-    }
-    // In we can't take off first line, we just empty the buffer
-    if (!firstLineEnd) {
-      this->logBufferFilled = 0;
-      this->logBufferLine = 0;
+  if (this->logBufferFilled >= this->logBufferSize || this->logBufferLine >= this->logBufferMaxLines) {
+    if (this->logBufferLine) {
+      // Chop off the first line, the ones below move up
+      uint16_t next = logLineStart(1);
+      this->logBufferFilled -= (next + this->logBufferSize - this->logBufferStart) % this->logBufferSize;
+      this->logBufferStart = next;
+      this->logFirstLine = (this->logFirstLine + 1) % (this->logBufferMaxLines + 1);
+      this->logBufferLine--;
+      scroll = lineHeight;
+    } else {
+      // In we can't take off first line, we just empty the buffer
+      emptyLogBuffer();
     }
   }
 
-  // So now we know for sure we have space in the buffer
-
-  // Find the length of the last line
-  uint16_t lastLineLen= 0;
-  for (uint16_t i = 0; i < this->logBufferFilled; i++) {
-    lastLineLen++;
-    if (this->logBuffer[i] == 10) lastLineLen = 0;
-  }
-  // if last line is max length, ignore anything but linebreaks
-  if (lastLineLen >= this->logBufferLineLen) {
-    if (c != 10) return 1;
+  // Write to the end of the ring
+  uint16_t end = (this->logBufferStart + this->logBufferFilled) % this->logBufferSize;
+  this->logBuffer[end] = c;
+  this->logBufferFilled++;
+
+  uint16_t index = NO_GLYPH;
+  uint16_t x     = this->logLastLineWidth;
+  if (c == 10) {
+    // Keep track of lines written
+    this->logBufferLine++;
+    this->logLineStarts[(this->logFirstLine + this->logBufferLine) % (this->logBufferMaxLines + 1)] = (end + 1) % this->logBufferSize;
+    this->logLastLineLen   = 0;
+    this->logLastLineWidth = 0;
+  } else {
+    this->logLastLineLen++;
+    index = glyphIndex(c, fontFlags & FONT_RANGES, logDecoder);
+    if (index != NO_GLYPH)
+      this->logLastLineWidth += getGlyphWidth(index);
   }
+  // The last line may have reached the bottom of the screen as well
+  scroll = scroll + logBufferShift() - shift;
 
-  // Write to buffer
-  this->logBuffer[this->logBufferFilled++] = c;
-  // Keep track of lines written
-  if (c == 10) this->logBufferLine++;
-
-  // Draw to screen unless we're writing a whole string at a time
-  if (!this->inhibitDrawLogBuffer) {
+  // Only draw what changed, as drawLogBuffer() would have drawn it
+  if (!this->logBufferDrawn) {
     clear();
     drawLogBuffer();
+  } else if (scroll) {
+    scrollLogBuffer(scroll);
+  } else if (index != NO_GLYPH && x <= this->width()) {
+    int16_t y = this->logBufferLine * lineHeight - logBufferShift();
+    if (y + lineHeight >= 0 && y < this->height())
+      drawGlyph(x, y, index);
+  }
+  this->logBufferDrawn = true;
+
+  // Send to screen unless we're writing a whole string at a time
+  if (!this->inhibitDrawLogBuffer) {
     display();
   }
 
@@ -999,17 +2059,18 @@ size_t OLEDDisplay::write(uint8_t c) {
 
 size_t OLEDDisplay::write(const char* str) {
   if (str == NULL) return 0;
-  size_t length = strlen(str);
-  // If we write a string, only do the drawLogBuffer at the end, not every time we write a char
+  return write((const uint8_t *) str, strlen(str));
+}
+
+size_t OLEDDisplay::write(const uint8_t *data, size_t size) {
+  // If we write a string, only send it to the screen at the end, not every time we write a char
   this->inhibitDrawLogBuffer = true;
-  for (size_t i = 0; i < length; i++) {
-    write(str[i]);
+  for (size_t i = 0; i < size; i++) {
+    write(data[i]);
   }
   this->inhibitDrawLogBuffer = false;
-  clear();
-  drawLogBuffer();
   display();
-  return length;
+  return size;
 }
 
 #ifdef __MBED__
@@ -1047,7 +2108,372 @@ void OLEDDisplay::setGeometry(OLEDDISPLAY_GEOMETRY g, uint16_t width, uint16_t h
   this->displayBufferSize = displayWidth * displayHeight / 8;
 }
 
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+// Native word of the CPU (32 bit on the ESP8266/ESP32, 64 bit on most hosts),
+// may_alias as it is used to read the uint8_t framebuffers.
+typedef uintptr_t __attribute__((__may_alias__)) diff_word_t;
+
+#define DIFF_WORD_MASK (sizeof(diff_word_t) - 1)
+
+// Index of the first byte that differs between a and b, or length if none does
+static uint16_t firstDifference(const uint8_t *a, const uint8_t *b, uint16_t length) {
+  uint16_t i = 0;
+  // Word compares need both rows to be equally aligned, which they are unless
+  // the driver uses a buffer offset that is not a multiple of the word size
+  if ((((uintptr_t) a ^ (uintptr_t) b) & DIFF_WORD_MASK) == 0) {
+    while (i < length && ((uintptr_t) (a + i) & DIFF_WORD_MASK)) {
+      if (a[i] != b[i]) return i;
+      i++;
+    }
+    while (i + sizeof(diff_word_t) <= length &&
+           *(const diff_word_t *) (a + i) == *(const diff_word_t *) (b + i)) {
+      i += sizeof(diff_word_t);
+    }
+  }
+  while (i < length && a[i] == b[i]) {
+    i++;
+  }
+  return i;
+}
+#endif
+
+#ifdef OLEDDISPLAY_SEGMENT_HASHES
+// FNV-1a hash of a segment, never 0 as that marks segments of unknown content
+static uint32_t segmentHash(const uint8_t *data, uint16_t length) {
+  uint32_t hash = 2166136261u;
+  while (length--) {
+    hash = (hash ^ *data++) * 16777619u;
+  }
+  return hash ? hash : 1;
+}
+#endif
+
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER) || defined(OLEDDISPLAY_DIRTY_TRACKING) || defined(OLEDDISPLAY_SEGMENT_HASHES)
+// Bytes covered by a region
+static uint16_t rectArea(const OLEDDisplayDirtyRect &rect) {
+  return (rect.x1 - rect.x0 + 1) * (rect.page1 - rect.page0 + 1);
+}
+
+static OLEDDisplayDirtyRect rectUnion(const OLEDDisplayDirtyRect &a, const OLEDDisplayDirtyRect &b) {
+  OLEDDisplayDirtyRect rect;
+  rect.x0 = a.x0 < b.x0 ? a.x0 : b.x0;
+  rect.x1 = a.x1 > b.x1 ? a.x1 : b.x1;
+  rect.page0 = a.page0 < b.page0 ? a.page0 : b.page0;
+  rect.page1 = a.page1 > b.page1 ? a.page1 : b.page1;
+  return rect;
+}
+
+// Adds a changed span to the list of regions. It is merged into an existing
+// region if sending the unchanged bytes in between costs less than addressing
+// a new region, or if limit regions are in use. Spans above wrapPage are only
+// merged with each other, as are the ones from wrapPage on.
+static uint8_t addDirtySpan(OLEDDisplayDirtyRect *rects, uint8_t count, const OLEDDisplayDirtyRect &span, uint16_t threshold,
+                            uint8_t wrapPage, uint8_t limit) {
+  uint8_t best = count;
+  uint32_t bestCost = UINT32_MAX;
+  for (uint8_t i = 0; i < count; i++) {
+    // Regions must not cross wrapPage
+    if ((rects[i].page0 < wrapPage) != (span.page0 < wrapPage)) continue;
+    uint32_t cost = rectArea(rectUnion(rects[i], span)) - rectArea(rects[i]);
+    if (cost < bestCost) {
+      bestCost = cost;
+      best = i;
+    }
+  }
+
+  if (best < count && (bestCost <= (uint32_t) rectArea(span) + threshold || count >= limit)) {
+    rects[best] = rectUnion(rects[best], span);
+    return count;
+  }
+  rects[count] = span;
+  return count + 1;
+}
+#endif
+
+void OLEDDisplay::setDirtyRectMergeThreshold(uint16_t bytes) {
+  this->dirtyRectMergeThreshold = bytes;
+}
+
+void OLEDDisplay::markDirty(int16_t x, int16_t y, int16_t width, int16_t height) {
+  if (x < 0) { width += x; x = 0; }
+  if (y < 0) { height += y; y = 0; }
+  if (x + width > this->width()) width = this->width() - x;
+  if (y + height > this->height()) height = this->height() - y;
+  if (width <= 0 || height <= 0) return;
+
+  touchRegion(x, x + width - 1, y >> 3, (y + height - 1) >> 3);
+}
+
+uint8_t OLEDDisplay::getDirtyRects() {
+  const uint16_t width = this->width();
+  const uint8_t pages = this->height() / 8;
+
+  // buffer_back and dirtyRects are still in use by the running transfer
+  waitForTransfer();
+
+  // The content moved by scrollPages() is shown before the pages that came
+  // into view are sent
+  if (startLinePending) {
+    // display() and displayAsync() have set up the bus already
+    const uint8_t command = SETSTARTLINE | (startPage << 3);
+    sendCommands(&command, 1);
+    startLinePending = false;
+  }
+
+  // The pages from wrapPage on are shown by the first pages of the display
+  // RAM, regions can't span both
+  uint8_t wrapPage = startPage && 8 - startPage < pages ? 8 - startPage : pages;
+
+  // The scroll engine moves the display RAM of pages heldPage0..heldPage1,
+  // their changes wait until stopScroll() has them sent whole. The start line
+  // is 0 while it runs, regions only must not span these pages.
+  const uint8_t heldPage0 = scrollActive ? scrollPage0 : pages;
+  const uint8_t heldPage1 = scrollActive ? scrollPage1 : pages;
+  if (scrollActive) {
+    wrapPage = scrollPage0;
+  }
+
+#if defined(OLEDDISPLAY_DOUBLE_BUFFER) || defined(OLEDDISPLAY_DIRTY_TRACKING) || defined(OLEDDISPLAY_SEGMENT_HASHES)
+  uint8_t count = 0;
+
+  for (uint8_t page = 0; page < pages; page++) {
+    uint16_t from = 0;
+    uint16_t to = width;
+    // Leave a region for the pages from wrapPage on
+    const uint8_t limit = page < wrapPage && wrapPage < pages ? OLEDDISPLAY_MAX_DIRTY_RECTS - 1 : OLEDDISPLAY_MAX_DIRTY_RECTS;
+
+    if (page >= heldPage0 && page <= heldPage1) continue;
+
+    if (stalePages & (1 << page)) {
+      // Nothing is known about the display RAM behind the page
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+      pageStates[page].dirtyX0 = UINT16_MAX;
+      pageStates[page].dirtyX1 = 0;
+#endif
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+      memcpy(&buffer_back[page * width], &buffer[page * width], width);
+#elif defined(OLEDDISPLAY_SEGMENT_HASHES)
+      for (uint8_t segment = 0; segment < segmentsPerPage; segment++) {
+        uint16_t x0 = segment * OLEDDISPLAY_HASH_SEGMENT_WIDTH;
+        uint16_t x1 = x0 + OLEDDISPLAY_HASH_SEGMENT_WIDTH < width ? x0 + OLEDDISPLAY_HASH_SEGMENT_WIDTH : width;
+        segmentHashes[page * segmentsPerPage + segment] = segmentHash(&buffer[page * width + x0], x1 - x0);
+      }
+#endif
+      OLEDDisplayDirtyRect span = { 0, (uint16_t) (width - 1), page, page };
+      count = addDirtySpan(dirtyRects, count, span, dirtyRectMergeThreshold, wrapPage, limit);
+      continue;
+    }
+
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+    // Nothing outside the columns the primitives touched can have changed
+    OLEDDisplayPageState &state = pageStates[page];
+    if (state.dirtyX0 > state.dirtyX1) continue;
+    from = state.dirtyX0;
+    to = state.dirtyX1 + 1;
+    state.dirtyX0 = UINT16_MAX;
+    state.dirtyX1 = 0;
+#endif
+
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    uint8_t *front = &buffer[page * width];
+    uint8_t *back = &buffer_back[page * width];
+
+    uint16_t x = from + firstDifference(front + from, back + from, to - from);
+    while (x < to) {
+      // Extend the span over changed bytes and gaps too small to be worth a new region
+      uint16_t end = x;
+      uint16_t next;
+      for (;;) {
+        while (end < to && front[end] != back[end]) end++;
+        next = end + firstDifference(front + end, back + end, to - end);
+        if (next == to || next - end > dirtyRectMergeThreshold) break;
+        end = next;
+      }
+      memcpy(back + x, front + x, end - x);
+
+      OLEDDisplayDirtyRect span = { x, (uint16_t) (end - 1), page, page };
+      count = addDirtySpan(dirtyRects, count, span, dirtyRectMergeThreshold, wrapPage, limit);
+      x = next;
+    }
+#elif defined(OLEDDISPLAY_SEGMENT_HASHES)
+    // Send every segment whose content differs from what was sent last time
+    uint32_t *hashes = &segmentHashes[page * segmentsPerPage];
+    for (uint8_t segment = from / OLEDDISPLAY_HASH_SEGMENT_WIDTH; segment * OLEDDISPLAY_HASH_SEGMENT_WIDTH < to; segment++) {
+      uint16_t x0 = segment * OLEDDISPLAY_HASH_SEGMENT_WIDTH;
+      uint16_t x1 = x0 + OLEDDISPLAY_HASH_SEGMENT_WIDTH < width ? x0 + OLEDDISPLAY_HASH_SEGMENT_WIDTH : width;
+
+      uint32_t hash = segmentHash(&buffer[page * width + x0], x1 - x0);
+      if (hash == hashes[segment]) continue;
+      hashes[segment] = hash;
+
+      // The change is within the segment and the columns touched since the last display()
+      OLEDDisplayDirtyRect span = { x0 > from ? x0 : from, (uint16_t) ((x1 < to ? x1 : to) - 1), page, page };
+      count = addDirtySpan(dirtyRects, count, span, dirtyRectMergeThreshold, wrapPage, limit);
+    }
+#else
+    // Without a copy of the display content every touched column is sent
+    OLEDDisplayDirtyRect span = { from, (uint16_t) (to - 1), page, page };
+    count = addDirtySpan(dirtyRects, count, span, dirtyRectMergeThreshold, wrapPage, limit);
+#endif
+  }
+
+  // Spans of later pages may have grown regions into each other. A merged
+  // region may now cover one that was already compared with it, so repeat
+  // until nothing changes.
+  bool merging = true;
+  while (merging) {
+    merging = false;
+    for (uint8_t i = 0; i < count; i++) {
+      for (uint8_t j = i + 1; j < count; j++) {
+        if ((dirtyRects[i].page0 < wrapPage) != (dirtyRects[j].page0 < wrapPage)) continue;
+        OLEDDisplayDirtyRect merged = rectUnion(dirtyRects[i], dirtyRects[j]);
+        if (rectArea(merged) <= rectArea(dirtyRects[i]) + rectArea(dirtyRects[j]) + dirtyRectMergeThreshold) {
+          dirtyRects[i] = merged;
+          dirtyRects[j--] = dirtyRects[--count];
+          merging = true;
+        }
+      }
+    }
+  }
+
+  // Overlapping regions send the overlap twice. Where that adds up to the
+  // area they span together, that area is sent instead.
+  for (uint8_t upper = 0; upper < 2; upper++) {
+    OLEDDisplayDirtyRect bounds = { 0, 0, 0, 0 };
+    uint8_t rects = 0;
+    uint32_t area = 0;
+    for (uint8_t i = 0; i < count; i++) {
+      if ((dirtyRects[i].page0 < wrapPage) != (upper == 0)) continue;
+      bounds = rects++ ? rectUnion(bounds, dirtyRects[i]) : dirtyRects[i];
+      area += rectArea(dirtyRects[i]);
+    }
+    if (rects > 1 && area >= rectArea(bounds)) {
+      uint8_t kept = 0;
+      for (uint8_t i = 0; i < count; i++) {
+        if ((dirtyRects[i].page0 < wrapPage) != (upper == 0)) dirtyRects[kept++] = dirtyRects[i];
+      }
+      dirtyRects[kept++] = bounds;
+      count = kept;
+    }
+  }
+  stalePages = 0;
+  yield();
+
+  return count;
+#else
+  // Without a copy of the display content everything has to be sent, in at
+  // most two regions as the held pages and wrapPage are at the same place
+  uint8_t count = 0;
+  for (uint8_t page = 0; page < pages; page++) {
+    if (page >= heldPage0 && page <= heldPage1) continue;
+    if (count && dirtyRects[count - 1].page1 == page - 1 && page != wrapPage) {
+      dirtyRects[count - 1].page1 = page;
+    } else {
+      OLEDDisplayDirtyRect rect = { 0, (uint16_t) (width - 1), page, page };
+      dirtyRects[count++] = rect;
+    }
+  }
+  stalePages = 0;
+  return count;
+#endif
+}
+
+bool OLEDDisplay::displayAsync(void) {
+  if (asyncBusy) return false;
+
+  if (!supportsRegionRows()) {
+    display();
+    if (displayCompleteCallback) displayCompleteCallback(this);
+    return true;
+  }
+
+  beginRegionRows();
+  asyncRects = getDirtyRects();
+  if (asyncRects == 0) {
+    if (displayCompleteCallback) displayCompleteCallback(this);
+    return true;
+  }
+  asyncRect = 0;
+  asyncPage = dirtyRects[0].page0;
+  asyncBusy = true;
+
+#ifdef OLEDDISPLAY_ASYNC_TASK
+  if (asyncTask == NULL) {
+    xTaskCreate(asyncTaskLoop, "OLEDDisplay", OLEDDISPLAY_ASYNC_TASK_STACK, this, 1, &asyncTask);
+  }
+  if (asyncTask == NULL) {
+    DEBUG_OLEDDISPLAY("[OLEDDISPLAY][displayAsync] Can't create transfer task\n");
+    while (sendNextRegionRow());
+  } else {
+    xTaskNotifyGive(asyncTask);
+  }
+#endif
+  return true;
+}
+
+bool OLEDDisplay::poll(void) {
+#ifdef OLEDDISPLAY_ASYNC_TASK
+  if (asyncTask != NULL) return asyncBusy;
+#endif
+  return asyncBusy && sendNextRegionRow();
+}
+
+bool OLEDDisplay::isBusy(void) {
+  return asyncBusy;
+}
+
+void OLEDDisplay::setDisplayCompleteCallback(DisplayCompleteCallback callback) {
+  this->displayCompleteCallback = callback;
+}
+
+bool OLEDDisplay::sendNextRegionRow(void) {
+  const OLEDDisplayDirtyRect &rect = dirtyRects[asyncRect];
+#ifdef OLEDDISPLAY_DOUBLE_BUFFER
+  const uint8_t *snapshot = buffer_back;
+#else
+  const uint8_t *snapshot = buffer;
+#endif
+  sendRegionRow(rect, asyncPage, &snapshot[asyncPage * this->width() + rect.x0]);
+
+  if (asyncPage < rect.page1) {
+    asyncPage++;
+    return true;
+  }
+  if (++asyncRect < asyncRects) {
+    asyncPage = dirtyRects[asyncRect].page0;
+    return true;
+  }
+
+  asyncBusy = false;
+  if (displayCompleteCallback) displayCompleteCallback(this);
+  return false;
+}
+
+void OLEDDisplay::waitForTransfer(void) {
+#ifdef OLEDDISPLAY_ASYNC_TASK
+  if (asyncTask != NULL) {
+    while (asyncBusy) delay(1);
+    return;
+  }
+#endif
+  while (asyncBusy && sendNextRegionRow());
+}
+
+#ifdef OLEDDISPLAY_ASYNC_TASK
+void OLEDDisplay::asyncTaskLoop(void *display) {
+  OLEDDisplay *self = (OLEDDisplay *) display;
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    while (self->asyncBusy && self->sendNextRegionRow());
+  }
+}
+#endif
+
 void OLEDDisplay::sendInitCommands(void) {
+  // Sets the start line back to 0 and stops the scroll engine
+  startPage = 0;
+  startLinePending = false;
+  scrollActive = false;
   if (geometry == GEOMETRY_RAWMODE)
   	return;
   sendCommand(DISPLAYOFF);
@@ -1089,7 +2515,7 @@ void OLEDDisplay::sendInitCommands(void) {
   sendCommand(0x40);	        //0x40 default, to lower the contrast, put 0
   sendCommand(DISPLAYALLON_RESUME);
   sendCommand(NORMALDISPLAY);
-  sendCommand(0x2e);            // stop scroll
+  sendCommand(DEACTIVATE_SCROLL);
   sendCommand(DISPLAYON);
 }
 
@@ -1099,68 +2525,23 @@ void inline OLEDDisplay::drawInternal(int16_t xMove, int16_t yMove, int16_t widt
   if (xMove + width  < 0 || xMove > this->width())   return;
 
   uint8_t  rasterHeight = 1 + ((height - 1) >> 3); // fast ceil(height / 8.0)
-  int8_t   yOffset      = yMove & 7;
 
   bytesInData = bytesInData == 0 ? width * rasterHeight : bytesInData;
 
-  int16_t initYMove   = yMove;
-  int8_t  initYOffset = yOffset;
-
-
-  for (uint16_t i = 0; i < bytesInData; i++) {
-
-    // Reset if next horizontal drawing phase is started.
-    if ( i % rasterHeight == 0) {
-      yMove   = initYMove;
-      yOffset = initYOffset;
-    }
-
-    uint8_t currentByte = pgm_read_byte(data + offset + i);
-
-    int16_t xPos = xMove + (i / rasterHeight);
-    int16_t yPos = ((yMove >> 3) + (i % rasterHeight)) * this->width();
-
-//    int16_t yScreenPos = yMove + yOffset;
-    int16_t dataPos    = xPos  + yPos;
-
-    if (dataPos >=  0  && dataPos < displayBufferSize &&
-        xPos    >=  0  && xPos    < this->width() ) {
-
-      if (yOffset >= 0) {
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte << yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte << yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte << yOffset; break;
-        }
-
-        if (dataPos < (displayBufferSize - this->width())) {
-          switch (this->color) {
-            case WHITE:   buffer[dataPos + this->width()] |= currentByte >> (8 - yOffset); break;
-            case BLACK:   buffer[dataPos + this->width()] &= ~(currentByte >> (8 - yOffset)); break;
-            case INVERSE: buffer[dataPos + this->width()] ^= currentByte >> (8 - yOffset); break;
-          }
-        }
-      } else {
-        // Make new offset position
-        yOffset = -yOffset;
-
-        switch (this->color) {
-          case WHITE:   buffer[dataPos] |= currentByte >> yOffset; break;
-          case BLACK:   buffer[dataPos] &= ~(currentByte >> yOffset); break;
-          case INVERSE: buffer[dataPos] ^= currentByte >> yOffset; break;
-        }
-
-        // Prepare for next iteration by moving one block up
-        yMove -= 8;
+  // The raster covers rasterHeight pages from yMove on, clipped to the display.
+  // Font glyphs can have more columns of raster than their advance width.
+  int16_t rasterWidth = (bytesInData + rasterHeight - 1) / rasterHeight;
+  int16_t lastRow = yMove + rasterHeight * 8 - 1;
+  int16_t lastColumn = xMove + (rasterWidth > width ? rasterWidth : width) - 1;
+  if (lastRow >= 0 && lastColumn >= 0 && yMove < this->height() && xMove < this->width()) {
+    touchRegion(xMove < 0 ? 0 : xMove, lastColumn < this->width() ? lastColumn : this->width() - 1,
+                yMove < 0 ? 0 : yMove >> 3, lastRow < this->height() ? lastRow >> 3 : (this->height() - 1) >> 3);
+  }
 
-        // and setting the new yOffset
-        yOffset = 8 - yOffset;
-      }
+  blitRaster(this->color, buffer, this->width(), displayBufferSize / this->width(), xMove, yMove, rasterHeight, data + offset, bytesInData);
 #ifndef __MBED__
-      yield();
+  yield();
 #endif
-    }
-  }
 }
 
 // You need to free the char!
@@ -1178,9 +2559,10 @@ char* OLEDDisplay::utf8ascii(const String &str) {
 
   length--;
 
+  OLEDDisplayUtf8Decoder decoder = { 0, 0 };
   for (uint16_t i=0; i < length; i++) {
-    char c = (this->fontTableLookupFunction)(s[i]);
-    if (c!=0) {
+    uint32_t c;
+    if (decodeChar(s[i], true, false, decoder, c)) {
       s[k++]=c;
     }
   }
@@ -57,10 +57,28 @@ private:
 	const char *_str;
 };
 
+#elif defined(__unix__) || defined(__APPLE__)
+#include "OLEDDisplayHost.h"
 #else
 #error "Unkown operating system"
 #endif
 
+// Milliseconds and microseconds since startup for the library's own timing,
+// wrapping at 2^32 like millis() and micros() on Arduino
+#ifdef __MBED__
+static inline uint32_t oled_millis() {
+#if MBED_MAJOR_VERSION >= 6
+  return (uint32_t) Kernel::Clock::now().time_since_epoch().count();
+#else
+  return (uint32_t) Kernel::get_ms_count();
+#endif
+}
+static inline uint32_t oled_micros() { return us_ticker_read(); }
+#else
+static inline uint32_t oled_millis() { return millis(); }
+static inline uint32_t oled_micros() { return micros(); }
+#endif
+
 #include "OLEDDisplayFonts.h"
 
 //#define DEBUG_OLEDDISPLAY(...) Serial.printf( __VA_ARGS__ )
@@ -75,6 +93,125 @@ private:
 #define OLEDDISPLAY_DOUBLE_BUFFER
 #endif
 
+// Let the drawing primitives record which columns of each page they change.
+// display() then only compares (with OLEDDISPLAY_REDUCE_MEMORY: only sends)
+// those instead of the whole buffer. Code that writes to buffer directly has
+// to report the area it changed with markDirty().
+//#define OLEDDISPLAY_DIRTY_TRACKING
+
+// Without the back buffer, display() keeps a 32 bit hash of every segment of
+// OLEDDISPLAY_HASH_SEGMENT_WIDTH columns of a page (128 bytes for 128x64) and
+// only sends the segments whose hash changed. Define
+// OLEDDISPLAY_NO_SEGMENT_HASHES to save that memory and send everything.
+#if defined(OLEDDISPLAY_REDUCE_MEMORY) && !defined(OLEDDISPLAY_NO_SEGMENT_HASHES)
+#define OLEDDISPLAY_SEGMENT_HASHES
+#endif
+
+#ifndef OLEDDISPLAY_HASH_SEGMENT_WIDTH
+#define OLEDDISPLAY_HASH_SEGMENT_WIDTH 32
+#endif
+
+// Maximum number of regions display() sends per frame, further changes are
+// merged into the existing regions. At least 2, after scrollPages() the top and
+// the bottom of the screen may need a region each.
+#ifndef OLEDDISPLAY_MAX_DIRTY_RECTS
+#define OLEDDISPLAY_MAX_DIRTY_RECTS 8
+#endif
+#if OLEDDISPLAY_MAX_DIRTY_RECTS < 2
+#error "OLEDDISPLAY_MAX_DIRTY_RECTS has to be at least 2"
+#endif
+
+// Default cost in bytes of starting a new region on the bus (COLUMNADDR and
+// PAGEADDR with their parameters plus a new data transaction). Changes closer
+// together than that are sent as one region, see setDirtyRectMergeThreshold()
+#ifndef OLEDDISPLAY_DIRTY_RECT_MERGE_THRESHOLD
+#define OLEDDISPLAY_DIRTY_RECT_MERGE_THRESHOLD 16
+#endif
+
+// On ESP32 displayAsync() hands the transfer to a FreeRTOS task, elsewhere the
+// application drives it by calling poll()
+#if defined(ARDUINO_ARCH_ESP32) && !defined(OLEDDISPLAY_NO_ASYNC_TASK)
+#define OLEDDISPLAY_ASYNC_TASK
+#endif
+
+#ifndef OLEDDISPLAY_ASYNC_TASK_STACK
+#define OLEDDISPLAY_ASYNC_TASK_STACK 2048
+#endif
+
+// Glyphs drawStringInternal() decodes from the font at a time, longer lines
+// are laid out in several runs
+#ifndef OLEDDISPLAY_GLYPH_RUN_LENGTH
+#define OLEDDISPLAY_GLYPH_RUN_LENGTH 48
+#endif
+
+// The Print console spaces its lines by the font height. Unless that is a
+// multiple of 8, a new line moves the whole buffer and sends the whole screen.
+// Define OLEDDISPLAY_LOG_PAGE_LINES to put the lines a whole number of pages
+// apart instead (16 rows for a 13 pixel font): fewer lines fit, but a new line
+// scrolls the screen with the display start line and only the new line is sent.
+//#define OLEDDISPLAY_LOG_PAGE_LINES
+
+// Chars (from the first char of the font on) setGlyphCache() keeps the metrics
+// of in RAM, 4 bytes each
+#ifndef OLEDDISPLAY_GLYPH_CACHE_CHARS
+#define OLEDDISPLAY_GLYPH_CACHE_CHARS 96
+#endif
+
+// Free heap in bytes the glyph cache leaves at least, below it is turned off
+#ifndef OLEDDISPLAY_GLYPH_CACHE_MIN_HEAP
+#define OLEDDISPLAY_GLYPH_CACHE_MIN_HEAP 8192
+#endif
+
+// Stack buffer drawString() copies each line of a flash string (F("...")) to,
+// longer lines are copied and drawn in chunks of this size
+#ifndef OLEDDISPLAY_FLASH_LINE_LENGTH
+#define OLEDDISPLAY_FLASH_LINE_LENGTH 128
+#endif
+
+// Chars createAtlas() renders at most, the size of OLEDDisplayAtlas grows by
+// 8 bytes per char
+#ifndef OLEDDISPLAY_ATLAS_CHARS
+#define OLEDDISPLAY_ATLAS_CHARS 16
+#endif
+
+// Frames per second of a 64 row display with the clock init() sets (half the
+// rows, twice the frames). stopScroll() estimates how far the scroll engine
+// got from it.
+#ifndef OLEDDISPLAY_FRAME_RATE
+#define OLEDDISPLAY_FRAME_RATE 96
+#endif
+
+// Bytes the drivers reserve in front of the framebuffer for their own header,
+// the largest getBufferOffset() of the bundled drivers (SSD1306I2C)
+#ifndef OLEDDISPLAY_MAX_BUFFER_OFFSET
+#define OLEDDISPLAY_MAX_BUFFER_OFFSET 1
+#endif
+
+// Alignment setBuffers() requires for caller provided framebuffer storage
+#ifndef OLEDDISPLAY_BUFFER_ALIGNMENT
+#define OLEDDISPLAY_BUFFER_ALIGNMENT 4
+#endif
+
+// Size of the storage for one framebuffer of the given geometry, enough for
+// every driver. getBufferSize() returns the exact size for a display.
+#define OLEDDISPLAY_BUFFER_SIZE(width, height) ((width) * (height) / 8 + OLEDDISPLAY_MAX_BUFFER_OFFSET)
+
+// Size of the storage for the per page state display() keeps next to the
+// framebuffer, 0 without OLEDDISPLAY_DIRTY_TRACKING and segment hashes.
+// getStateSize() returns the size for a display.
+#ifdef OLEDDISPLAY_DIRTY_TRACKING
+#define OLEDDISPLAY_PAGE_STATES_SIZE(height) ((height) / 8 * sizeof(OLEDDisplayPageState))
+#else
+#define OLEDDISPLAY_PAGE_STATES_SIZE(height) 0
+#endif
+#ifdef OLEDDISPLAY_SEGMENT_HASHES
+#define OLEDDISPLAY_SEGMENT_HASHES_SIZE(width, height) \
+  (((width) + OLEDDISPLAY_HASH_SEGMENT_WIDTH - 1) / OLEDDISPLAY_HASH_SEGMENT_WIDTH * ((height) / 8) * sizeof(uint32_t))
+#else
+#define OLEDDISPLAY_SEGMENT_HASHES_SIZE(width, height) 0
+#endif
+#define OLEDDISPLAY_STATE_SIZE(width, height) (OLEDDISPLAY_PAGE_STATES_SIZE(height) + OLEDDISPLAY_SEGMENT_HASHES_SIZE(width, height))
+
 // Header Values
 #define JUMPTABLE_BYTES 4
 
@@ -88,21 +225,47 @@ private:
 #define FIRST_CHAR_POS 2
 #define CHAR_NUM_POS 3
 
+// Fonts with a 0 in place of the width use the extended header, which adds a
+// byte of FONT_* flags and moves the width behind it
+#define EXTENDED_FONT_MARKER 0
+#define FONT_FLAGS_POS 4
+#define EXTENDED_WIDTH_POS 5
+#define EXTENDED_JUMPTABLE_START 6
+
+// The glyphs are bit packed: columns, first row and number of rows of the
+// glyph's ink, then the rows bits of every column, LSB first
+#define FONT_BITPACKED 0x01
+
+// The font covers ranges of Unicode code points instead of the chars from
+// the first char on, text is decoded from UTF-8. The header is followed by the
+// number of ranges and one RANGE_BYTES entry per range, sorted by code point:
+// the first code point (3 bytes, MSB first), the number of chars and the
+// index of the range's first glyph in the jump table (MSB first). The first
+// char and number of chars of the header are not used.
+#define FONT_RANGES 0x02
+#define RANGE_COUNT_POS 6
+#define RANGE_TABLE_START 7
+#define RANGE_BYTES 6
+
 
 // Display commands
+#define ACTIVATE_SCROLL 0x2F
 #define CHARGEPUMP 0x8D
 #define COLUMNADDR 0x21
 #define COMSCANDEC 0xC8
 #define COMSCANINC 0xC0
+#define DEACTIVATE_SCROLL 0x2E
 #define DISPLAYALLON 0xA5
 #define DISPLAYALLON_RESUME 0xA4
 #define DISPLAYOFF 0xAE
 #define DISPLAYON 0xAF
 #define EXTERNALVCC 0x1
 #define INVERTDISPLAY 0xA7
+#define LEFT_HORIZONTAL_SCROLL 0x27
 #define MEMORYMODE 0x20
 #define NORMALDISPLAY 0xA6
 #define PAGEADDR 0x22
+#define RIGHT_HORIZONTAL_SCROLL 0x26
 #define SEGREMAP 0xA0
 #define SETCOMPINS 0xDA
 #define SETCONTRAST 0x81
@@ -115,7 +278,10 @@ private:
 #define SETSEGMENTREMAP 0xA1
 #define SETSTARTLINE 0x40
 #define SETVCOMDETECT 0xDB
+#define SET_VERTICAL_SCROLL_AREA 0xA3
 #define SWITCHCAPVCC 0x2
+#define VERTICAL_AND_LEFT_HORIZONTAL_SCROLL 0x2A
+#define VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL 0x29
 
 #ifndef _swap_int16_t
 #define _swap_int16_t(a, b) { int16_t t = a; a = b; b = t; }
@@ -143,16 +309,108 @@ enum OLEDDISPLAY_GEOMETRY {
   GEOMETRY_RAWMODE  = 4
 };
 
+enum OLEDDISPLAY_SCROLL_DIRECTION {
+  SCROLL_RIGHT = 0,
+  SCROLL_LEFT = 1
+};
+
+// Frames between two steps of the scroll engine, the values are the ones the
+// SSD1306 expects
+enum OLEDDISPLAY_SCROLL_INTERVAL {
+  SCROLL_INTERVAL_2_FRAMES   = 7,
+  SCROLL_INTERVAL_3_FRAMES   = 4,
+  SCROLL_INTERVAL_4_FRAMES   = 5,
+  SCROLL_INTERVAL_5_FRAMES   = 0,
+  SCROLL_INTERVAL_25_FRAMES  = 6,
+  SCROLL_INTERVAL_64_FRAMES  = 1,
+  SCROLL_INTERVAL_128_FRAMES = 2,
+  SCROLL_INTERVAL_256_FRAMES = 3
+};
+
+// What stopScroll() does about the content the scroll engine moved
+enum OLEDDISPLAY_SCROLL_SYNC {
+  SCROLL_SYNC_BUFFER  = 0,  // Move the buffer the way the engine moved the display
+  SCROLL_SYNC_RESTORE = 1   // Leave the buffer, the display jumps back to it
+};
+
 enum HW_I2C {
   I2C_ONE,
   I2C_TWO
 };
 
+// A region of the display RAM, columns x0..x1 of pages page0..page1 (inclusive)
+struct OLEDDisplayDirtyRect {
+  uint16_t x0;
+  uint16_t x1;
+  uint8_t  page0;
+  uint8_t  page1;
+};
+
+// Jump table entry of a glyph, decoded
+struct OLEDDisplayGlyphMetrics {
+  uint16_t dataPosition;  // Offset of the raster data in the font, 0 if there is nothing to draw
+  uint8_t  byteSize;
+  uint8_t  width;
+};
+
+// A glyph of a laid out line of text, decoded once from the font's jump table
+struct OLEDDisplayGlyph {
+  uint16_t dataPosition;  // Offset of the raster data in the font, 0 if there is nothing to draw
+  uint16_t textPosition;  // Index of the char in the text
+  uint8_t  byteSize;
+  uint8_t  width;
+};
+
+// The glyphs of a few chars of one font (clock digits, units), rendered once
+// by createAtlas() into RAM in the page layout of the framebuffer
+struct OLEDDisplayAtlas {
+  uint8_t  *data;                               // pages rows of width bytes, NULL if empty
+  uint16_t width;
+  uint8_t  pages;
+  uint8_t  height;                              // Of the font
+  uint8_t  chars;
+  bool     ranged;                              // The font has FONT_RANGES, codes are code points
+  uint32_t codes[OLEDDISPLAY_ATLAS_CHARS];      // As decodeChar() returns them
+  uint8_t  advance[OLEDDISPLAY_ATLAS_CHARS];
+  uint16_t column[OLEDDISPLAY_ATLAS_CHARS + 1]; // First column of each glyph in data
+};
+
+// Traffic on the bus to the display, as counted by drivers that keep statistics
+struct OLEDDisplayBusStats {
+  uint32_t commandBytes;
+  uint32_t dataBytes;
+  uint32_t transactions;
+  uint32_t wireBytes;     // Everything on the bus, including address and control bytes
+};
+
+// Columns of one display page changed since the last display() (dirty) and
+// drawn to since the last clear() (ink). x0 > x1 if there are none.
+struct OLEDDisplayPageState {
+  uint16_t dirtyX0;
+  uint16_t dirtyX1;
+  uint16_t inkX0;
+  uint16_t inkX1;
+};
+
+// State of a UTF-8 decoder between the bytes of a char
+struct OLEDDisplayUtf8Decoder {
+  uint32_t codePoint;
+  uint8_t  pending;       // Continuation bytes still expected
+};
+
 typedef char (*FontTableLookupFunction)(const uint8_t ch);
+
+// Converts UTF-8 to Latin-1 a byte at a time, keeping the state between the
+// bytes of a char in a static variable. OLEDDisplay decodes the text itself
+// (with the state per call) while this is the lookup function, only custom
+// functions are called per byte.
 char DefaultFontTableLookup(const uint8_t ch);
 
+class OLEDDisplay;
+typedef void (*DisplayCompleteCallback)(OLEDDisplay *display);
 
-#ifdef ARDUINO
+
+#if defined(ARDUINO) || defined(OLEDDISPLAY_HOST)
 class OLEDDisplay : public Print  {
 #elif __MBED__
 class OLEDDisplay : public Stream {
@@ -175,6 +433,24 @@ class OLEDDisplay : public Stream {
     // Returns false if buffer allocation failed, true otherwise.
     bool init();
 
+    // Makes allocateBuffer() use the given storage instead of malloc() for the
+    // framebuffer and, with OLEDDISPLAY_DOUBLE_BUFFER, the back buffer. Each
+    // needs getBufferSize() bytes aligned to OLEDDISPLAY_BUFFER_ALIGNMENT and
+    // stays in use until setBuffers(NULL) is called, also across end().
+    // stateStorage of getStateSize() bytes holds the dirty tracking and segment
+    // hashes, without it they are still allocated with malloc().
+    // Returns false while the display is initialized or if the storage is
+    // missing or misaligned.
+    bool setBuffers(uint8_t *storage, uint8_t *backStorage = NULL, uint8_t *stateStorage = NULL);
+
+    // Bytes one framebuffer of the current geometry needs, including the
+    // driver's header
+    uint16_t getBufferSize(void);
+
+    // Bytes the stateStorage of setBuffers() needs for the current geometry,
+    // 0 if display() keeps no state per page
+    uint16_t getStateSize(void);
+
     // Free the memory used by the display
     void end();
 
@@ -242,8 +518,15 @@ class OLEDDisplay : public Stream {
 
     /* Text functions */
 
-    // Draws a string at the given location, returns how many chars have been written
+    // Draws a string at the given location, returns how many chars have been written.
+    // The const char* and flash string versions draw without allocating memory,
+    // flash strings are copied to the stack OLEDDISPLAY_FLASH_LINE_LENGTH bytes
+    // at a time.
+    uint16_t drawString(int16_t x, int16_t y, const char *text);
     uint16_t drawString(int16_t x, int16_t y, const String &text);
+#ifndef __MBED__
+    uint16_t drawString(int16_t x, int16_t y, const __FlashStringHelper *text);
+#endif
 
     // Draws a formatted string (like printf) at the given location
     void drawStringf(int16_t x, int16_t y, char* buffer, String format, ... );
@@ -253,13 +536,15 @@ class OLEDDisplay : public Stream {
     // The text will be wrapped to the next line at a space or dash
     // returns 0 if everything fits on the screen or the numbers of characters in the
     // first line if not
+    uint16_t drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const char *text);
     uint16_t drawStringMaxWidth(int16_t x, int16_t y, uint16_t maxLineWidth, const String &text);
 
     // Returns the width of the const char* with the current
     // font settings
     uint16_t getStringWidth(const char* text, uint16_t length, bool utf8 = false);
 
-    // Convencience method for the const char version
+    // Convencience methods for the const char version
+    uint16_t getStringWidth(const char *text);
     uint16_t getStringWidth(const String &text);
 
     // Specifies relative to which anchor point
@@ -277,6 +562,32 @@ class OLEDDisplay : public Stream {
     // Set the function that will convert utf-8 to font table index
     void setFontTableLookupFunction(FontTableLookupFunction function);
 
+    // Keeps the decoded metrics of the first OLEDDISPLAY_GLYPH_CACHE_CHARS chars
+    // of the current font in RAM, so text functions read them from flash once
+    // per setFont(). Returns false if less than OLEDDISPLAY_GLYPH_CACHE_MIN_HEAP
+    // bytes of heap would be left. setFont() turns the cache off when the free
+    // heap drops below that.
+    bool setGlyphCache(bool enabled);
+
+    // Bytes of RAM used by the glyph cache, 0 if it is off
+    uint16_t getGlyphCacheSize(void);
+
+    // Renders the chars of charset (UTF-8, at most OLEDDISPLAY_ATLAS_CHARS) in
+    // the current font into atlas, allocating atlas.data. Returns false if the
+    // memory is missing or charset has too many chars.
+    bool createAtlas(OLEDDisplayAtlas &atlas, const char *charset);
+
+    // Frees the memory of an atlas made by createAtlas()
+    void freeAtlas(OLEDDisplayAtlas &atlas);
+
+    // Draws a single line of text with the glyphs of atlas instead of the
+    // font, chars that are not in the atlas are skipped. A whole page row of a
+    // glyph is written at once, at a y that is a multiple of 8 it is a plain
+    // copy. Opaque text also draws the background of its glyphs, atlas.pages * 8
+    // rows high, so it can replace the previous text without clearing it.
+    // Honors the text alignment, returns the width of the text.
+    uint16_t drawStringAtlas(int16_t x, int16_t y, const OLEDDisplayAtlas &atlas, const char *text, bool opaque = false);
+
     /* Display functions */
 
     // Turn the display on
@@ -308,9 +619,82 @@ class OLEDDisplay : public Stream {
     // Mirror the display (to be used in a mirror or as a projector)
     void mirrorScreen();
 
+    // Moves the content of the screen up by the given number of pages (8 rows
+    // each, down if negative) by changing the display start line of the
+    // controller, so the next display() only sends the pages that came into
+    // view instead of the whole screen. These pages are cleared in the buffer,
+    // draw their new content before calling display(). Scrolling by the height
+    // of the screen or more only clears the buffer. A running scroll engine is
+    // stopped first.
+    void scrollPages(int8_t pages);
+
+    // Lets the scroll engine of the SSD1306 move pages page0..page1 of the
+    // screen sideways by a column every interval frames, without any work or
+    // bus traffic per step. What leaves one side comes back on the other. It
+    // starts from what the buffer shows, display() is called first. Returns
+    // false if the controller (SH1106) or the geometry has no scroll engine.
+    // While it runs display() holds back the changes of the scrolled pages.
+    // Displays narrower than 128 columns show the middle of the display RAM,
+    // the content passes the hidden columns on its way round.
+    bool startScroll(OLEDDISPLAY_SCROLL_DIRECTION direction, uint8_t page0, uint8_t page1,
+                     OLEDDISPLAY_SCROLL_INTERVAL interval = SCROLL_INTERVAL_5_FRAMES);
+
+    // Like startScroll(), but every step also moves rows top..top+rows-1 of
+    // the screen up by rowsPerStep rows (rows 0: down to the bottom). Rows
+    // that leave the top come back at the bottom. rowsPerStep 0 is the same
+    // as startScroll().
+    bool startDiagonalScroll(OLEDDISPLAY_SCROLL_DIRECTION direction, uint8_t page0, uint8_t page1,
+                             uint8_t rowsPerStep, OLEDDISPLAY_SCROLL_INTERVAL interval = SCROLL_INTERVAL_5_FRAMES,
+                             uint8_t top = 0, uint8_t rows = 0);
+
+    // Stops the scroll engine. With SCROLL_SYNC_BUFFER the buffer is moved by
+    // the steps the engine made, estimated from the time it ran (see
+    // OLEDDISPLAY_FRAME_RATE), otherwise it stays as it is. Either way the
+    // scrolled pages are sent again, so the display shows the buffer.
+    void stopScroll(OLEDDISPLAY_SCROLL_SYNC sync = SCROLL_SYNC_BUFFER);
+
+    // Like stopScroll(SCROLL_SYNC_BUFFER) with the number of steps the engine
+    // made, for applications that know it better than the estimate
+    void stopScrollAfter(uint32_t steps);
+
+    // True while the scroll engine runs
+    bool isScrolling(void);
+
+    // Steps the scroll engine made so far, estimated from the time it runs
+    uint32_t getScrollSteps(void);
+
     // Write the buffer to the display memory
     virtual void display(void) = 0;
 
+    // Changed regions of the framebuffer are sent separately unless sending
+    // the unchanged bytes between them costs less than the given number of
+    // bytes, which should be about what addressing a new region costs on the bus
+    void setDirtyRectMergeThreshold(uint16_t bytes);
+
+    // Reports an area of the buffer that was changed without the drawing
+    // functions, only needed with OLEDDISPLAY_DIRTY_TRACKING
+    void markDirty(int16_t x, int16_t y, int16_t width, int16_t height);
+
+    // Starts writing the changes to the display memory without waiting for the bus.
+    // With double buffering the changes are sent from buffer_back, so drawing can
+    // go on right away. Without it, don't draw until the transfer is complete.
+    // Returns false (and sends nothing) while the previous transfer is running.
+    // Drivers without incremental transfers send everything before returning.
+    bool displayAsync(void);
+
+    // Sends the next part (one page of one region) of a transfer started by
+    // displayAsync(). Returns true while there is more to send. Not needed on
+    // ESP32, where a task does the sending.
+    bool poll(void);
+
+    // Returns true while a transfer started by displayAsync() is running. Don't
+    // send commands to the display (setContrast(), displayOff(), ...) until it is done.
+    bool isBusy(void);
+
+    // Called when a transfer started by displayAsync() is complete. On ESP32 it
+    // runs on the transfer task.
+    void setDisplayCompleteCallback(DisplayCompleteCallback callback);
+
     // Clear the local pixel buffer
     void clear(void);
 
@@ -320,6 +704,11 @@ class OLEDDisplay : public Stream {
     // various function that work on it also work here. These functions include
     // print, println and printf. 
 
+    // Only what a char changes is drawn: the char itself, or the lines that
+    // come into view when the screen scrolls up. Anything else drawn to the
+    // buffer stays until it scrolls off. After clear() the next print redraws
+    // all lines.
+
     // cls() will clear the display immediately and empty the logBuffer, meaning
     // the next print statement will print at the top of the display again.
     // cls() should not be confused with clear(), which only clears the internal
@@ -341,6 +730,8 @@ class OLEDDisplay : public Stream {
     // Implement needed function to be compatible with Print class
     size_t write(uint8_t c);
     size_t write(const char* s);
+    // Draws all chars before sending the result to the display once
+    size_t write(const uint8_t *data, size_t size);
 
     // Implement needed function to be compatible with Stream class
 #ifdef __MBED__
@@ -371,44 +762,345 @@ class OLEDDisplay : public Stream {
 
     const uint8_t	 *fontData;
 
-    // State values for logBuffer
+    // Read from the header of the current font by readFontHeader()
+    uint8_t   fontFlags;
+    uint8_t   fontFirstChar;
+    uint16_t  fontChars;        // Entries of the jump table
+    uint16_t  fontJumpTable;    // Offset of the jump table
+    void readFontHeader();
+
+    // Offset of the glyph data behind the jump table of the current font
+    uint16_t fontDataStart() {
+      return fontJumpTable + fontChars * JUMPTABLE_BYTES;
+    }
+
+    // Feeds the next byte of a text to the decoder, returns true with the code
+    // of the char once it is complete. For ranged (FONT_RANGES) fonts utf8 text
+    // is decoded to code points, else the font table lookup function converts it.
+    bool decodeChar(uint8_t ch, bool utf8, bool ranged, OLEDDisplayUtf8Decoder &decoder, uint32_t &code);
+
+    // Like decodeChar() for the current font, returns the jump table index of
+    // the glyph of a complete char and 0xFFFF otherwise or if the font lacks it
+    uint16_t glyphIndex(uint8_t ch, bool utf8, OLEDDisplayUtf8Decoder &decoder);
+
+    // Jump table index of a code point in a FONT_RANGES font, 0xFFFF if it is missing
+    uint16_t findGlyph(uint32_t codePoint);
+
+    // State values for logBuffer, a ring of logBufferSize chars
     uint16_t   logBufferSize;
+    uint16_t   logBufferStart;      // Index of the first char
     uint16_t   logBufferFilled;
-    uint16_t   logBufferLine;
+    uint16_t   logBufferLine;       // Line breaks in the buffer
     uint16_t   logBufferMaxLines;
     uint16_t   logBufferLineLen;
+    uint16_t   logLastLineLen;      // Chars of the last line
+    uint16_t   logLastLineWidth;    // Width of the last line in pixels
+    // Index of the first char of lines 1..logBufferLine, a ring of
+    // logBufferMaxLines + 1 entries from logFirstLine on
+    uint16_t  *logLineStarts;
+    uint16_t   logFirstLine;
     char      *logBuffer;
+    // A line that wraps around the end of logBuffer is copied here to draw it
+    char      *logLineCopy;
+    // Set while write() draws several chars, they are sent to the display at the end
     bool      inhibitDrawLogBuffer;
+    // True while the buffer shows the lines of the logBuffer, so write() only
+    // has to draw what changes. clear() resets it.
+    bool      logBufferDrawn;
+    // Keeps the UTF-8 sequences write() receives a byte at a time
+    OLEDDisplayUtf8Decoder logDecoder;
 
 
 	// the header size of the buffer used, e.g. for the SPI command header
   int BufferOffset;
 	virtual int getBufferOffset(void) = 0;
 
+    // Storage passed to setBuffers(), NULL if allocateBuffer() uses malloc()
+    uint8_t   *bufferStorage;
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    uint8_t   *bufferBackStorage;
+    #endif
+    uint8_t   *stateStorage;
+
+    // Frees the framebuffers (unless they use bufferStorage) and clears the pointers
+    void releaseBuffers();
+
     // Send a command to the display (low level function)
     virtual void sendCommand(uint8_t com) {(void)com;};
 
+    // Send several commands while the bus is set up for a frame, drivers that
+    // can batch them in one transmission override it
+    virtual void sendCommands(const uint8_t *commands, uint8_t length) {
+      while (length--) sendCommand(*commands++);
+    }
+
     // Connect to the display
     virtual bool connect() { return false; };
 
     // Send all the init commands
     void sendInitCommands();
 
+    // Page of the display RAM that shows page 0 of the buffer, changed by
+    // scrollPages(). The next display() sends the start line if it is pending.
+    uint8_t   startPage;
+    bool      startLinePending;
+    // Pages of the buffer whose display RAM content is unknown after
+    // scrollPages(), the next display() sends them whole
+    uint8_t   stalePages;
+
+    // Settings of the running scroll engine. It moves the display RAM of
+    // pages scrollPage0..scrollPage1, getDirtyRects() leaves them out.
+    bool      scrollActive;
+    uint8_t   scrollPage0;
+    uint8_t   scrollPage1;
+    uint8_t   scrollColumnPage0;    // The pages moved sideways
+    uint8_t   scrollColumnPage1;
+    uint8_t   scrollDirection;
+    uint8_t   scrollInterval;       // OLEDDISPLAY_SCROLL_INTERVAL
+    uint8_t   scrollRowsPerStep;    // 0 if the rows don't move
+    uint8_t   scrollTop;
+    uint8_t   scrollRows;
+    uint32_t  scrollStart;          // oled_millis() when it started
+
+    // Drivers of controllers without a scroll engine (SH1106) return false
+    virtual bool supportsScrollEngine(void) { return true; }
+
+    // Moves the buffer the way steps steps of the scroll engine move the display
+    void moveScrolledContent(uint32_t steps);
+
+    // Page of the display RAM that shows a page of the buffer. The controllers
+    // have 8 pages of display RAM, the regions from getDirtyRects() never wrap
+    // around their end.
+    uint8_t ramPage(uint8_t page) {
+      uint8_t ram = page + startPage;
+      return ram >= 8 ? ram - 8 : ram;
+    }
+
+    // Regions display() has to send, filled by getDirtyRects()
+    OLEDDisplayDirtyRect dirtyRects[OLEDDISPLAY_MAX_DIRTY_RECTS];
+    uint16_t  dirtyRectMergeThreshold;
+
+    #ifdef OLEDDISPLAY_DIRTY_TRACKING
+    // One entry per page, allocated with the buffer or in stateStorage
+    OLEDDisplayPageState *pageStates;
+    #endif
+
+    #ifdef OLEDDISPLAY_SEGMENT_HASHES
+    // Hash of every segment as last sent to the display, 0 if unknown.
+    // Allocated with the buffer or in stateStorage after the pageStates,
+    // segmentsPerPage entries per page.
+    uint32_t  *segmentHashes;
+    uint8_t   segmentsPerPage;
+    #endif
+
+    // Records that columns x0..x1 of pages page0..page1 of the buffer were drawn to
+    void touchRegion(uint16_t x0, uint16_t x1, uint8_t page0, uint8_t page1) {
+    #ifdef OLEDDISPLAY_DIRTY_TRACKING
+      for (uint8_t page = page0; page <= page1; page++) {
+        OLEDDisplayPageState &state = pageStates[page];
+        if (x0 < state.dirtyX0) state.dirtyX0 = x0;
+        if (x1 > state.dirtyX1) state.dirtyX1 = x1;
+        if (x0 < state.inkX0) state.inkX0 = x0;
+        if (x1 > state.inkX1) state.inkX1 = x1;
+      }
+    #else
+      (void)x0; (void)x1; (void)page0; (void)page1;
+    #endif
+    }
+
+    // State of the transfer started by displayAsync()
+    volatile bool asyncBusy;
+    uint8_t   asyncRects;
+    uint8_t   asyncRect;
+    uint8_t   asyncPage;
+    DisplayCompleteCallback displayCompleteCallback;
+    #ifdef OLEDDISPLAY_ASYNC_TASK
+    TaskHandle_t asyncTask;
+    static void asyncTaskLoop(void *display);
+    #endif
+
+    // Drivers that can send a single page of a region, with the addressing it
+    // needs, return true and implement sendRegionRow(). Only they transfer
+    // asynchronously.
+    virtual bool supportsRegionRows(void) { return false; }
+    // Called once by displayAsync() before a transfer, e.g. to set up the bus
+    virtual void beginRegionRows(void) {}
+    virtual void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      (void)rect; (void)page; (void)data;
+    }
+
+    // Sends the next page of the running transfer, returns false when it is complete
+    bool sendNextRegionRow(void);
+
+    // Blocks until a running displayAsync() transfer is complete
+    void waitForTransfer(void);
+
+    // Determines which regions of the framebuffer have to be sent to the display,
+    // stores them in dirtyRects and returns their number (0 if nothing changed).
+    // With double buffering every change is copied to buffer_back along the way.
+    // A running displayAsync() transfer is completed first, a pending start line
+    // is sent before returning.
+    uint8_t getDirtyRects();
+
     // converts utf8 characters to extended ascii
     char* utf8ascii(const String &s);
 
     void inline drawInternal(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *data, uint16_t offset, uint16_t bytesInData) __attribute__((always_inline));
 
-    uint16_t drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, uint16_t textWidth, bool utf8);
+    // Combines column major raster data (rasterHeight bytes per column) into a
+    // buffer with displayPages pages of displayWidth bytes, see drawInternal()
+    template <OLEDDISPLAY_COLOR C>
+    static void blitRaster(uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                           int16_t xMove, int16_t yMove, uint8_t rasterHeight,
+                           const uint8_t *data, uint16_t bytesInData);
+    static inline void blitRaster(OLEDDISPLAY_COLOR color, uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                                  int16_t xMove, int16_t yMove, uint8_t rasterHeight,
+                                  const uint8_t *data, uint16_t bytesInData);
+
+    // Cached glyph metrics of the current font, entries with dataPosition
+    // 0xFFFF have not been read yet
+    OLEDDisplayGlyphMetrics *glyphCache;
+    uint8_t   glyphCacheChars;
+
+    // Metrics of the glyph at index (char code - first char) of the jump table,
+    // dataStart is the offset of the raster data behind the jump table
+    void getGlyphMetrics(uint16_t index, uint16_t dataStart, OLEDDisplayGlyphMetrics &metrics);
+    uint8_t getGlyphWidth(uint16_t index);
+
+    // Decodes the chars of text from position on into glyphs and adds their
+    // widths to width. Stops after maxGlyphs glyphs or once width exceeds
+    // maxWidth, without glyphs it only measures the rest of the text. Returns
+    // the number of glyphs.
+    uint8_t layoutGlyphs(const char* text, uint16_t textLength, bool utf8, uint16_t &position, uint16_t &width,
+                         OLEDDisplayGlyph *glyphs = NULL, uint8_t maxGlyphs = 0, uint16_t maxWidth = 0xFFFF);
+
+    // Draws a glyph of a FONT_BITPACKED font, decoding it straight into the buffer
+    void drawPackedGlyph(int16_t xMove, int16_t yMove, const uint8_t *glyph);
+
+    // Draws one line of text, returns the number of chars up to the first one
+    // that starts right of the display
+    uint16_t drawStringInternal(int16_t xMove, int16_t yMove, const char* text, uint16_t textLength, bool utf8);
+#ifndef __MBED__
+    // Draws a line of a flash string longer than OLEDDISPLAY_FLASH_LINE_LENGTH
+    // through chunk, a buffer of that size
+    uint16_t drawFlashLine(int16_t xMove, int16_t yMove, PGM_P text, uint16_t length, char *chunk);
+#endif
 
     // (re)creates the logBuffer that printing uses to remember what was on the
     // screen already 
     bool setLogBuffer();
 
-    // Draws the contents of the logBuffer to the screen
-    void drawLogBuffer();
+    // Forgets all lines of the logBuffer
+    void emptyLogBuffer();
+
+    // Index of the first char of a line of the logBuffer
+    uint16_t logLineStart(uint16_t line) {
+      return line ? logLineStarts[(logFirstLine + line) % (logBufferMaxLines + 1)] : logBufferStart;
+    }
+
+    // Rows from one line of the logBuffer to the next
+    uint16_t logLineHeight();
+
+    // Rows the lines of the logBuffer are moved up by. Once it holds
+    // logBufferMaxLines line breaks the last one ends at the bottom of the
+    // screen, so the first line is the one that is cut off.
+    uint16_t logBufferShift();
+
+    // Draws the lines of the logBuffer that reach below row top of the screen.
+    // With top > 0 the buffer is cleared from the first of them on.
+    void drawLogBuffer(int16_t top = 0);
+
+    // Moves the screen up by rows after the lines of the logBuffer moved up,
+    // then draws the lines that came into view
+    void scrollLogBuffer(uint16_t rows);
+
+    // Moves the content of the buffer up by rows, the rows at the bottom are cleared
+    void shiftBufferUp(uint16_t rows);
+
+    // Clears the buffer from row on
+    void clearRows(uint16_t row);
+
+    // Draws the glyph at index of the jump table of the current font, returns its width
+    uint8_t drawGlyph(int16_t xMove, int16_t yMove, uint16_t index);
 
 	FontTableLookupFunction fontTableLookupFunction;
 };
 
+// Combines one byte of raster data into the buffer, the color is a template
+// argument so the blit loops below do not test it per byte
+template <OLEDDISPLAY_COLOR C>
+static inline void oledDisplayBlitByte(uint8_t *dst, uint8_t bits) {
+  if (C == WHITE)      *dst |= bits;
+  else if (C == BLACK) *dst &= ~bits;
+  else                 *dst ^= bits;
+}
+
+// Draws a column major raster (rasterHeight bytes per column) at xMove/yMove.
+// Every raster row lands in the page it starts in and, unless yMove is page
+// aligned, spills into the page below. Clipping is done once per raster row,
+// the inner loop only walks the columns that are on screen.
+template <OLEDDISPLAY_COLOR C>
+void OLEDDisplay::blitRaster(uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                             int16_t xMove, int16_t yMove, uint8_t rasterHeight,
+                             const uint8_t *data, uint16_t bytesInData) {
+  int16_t firstPage = yMove >> 3;
+  uint8_t shift     = yMove & 7;
+  int16_t x0        = xMove < 0 ? 0 : xMove;
+
+  for (uint8_t r = 0; r < rasterHeight && r < bytesInData; r++) {
+    int16_t upper = firstPage + r;
+    int16_t lower = upper + 1;
+    bool hasUpper = upper >= 0 && upper < displayPages;
+    bool hasLower = shift != 0 && lower >= 0 && lower < displayPages;
+    if (!hasUpper && !hasLower) continue;
+
+    // bytesInData may end in the middle of a column
+    int32_t x1 = xMove + (int32_t) (bytesInData - r + rasterHeight - 1) / rasterHeight;
+    if (x1 > displayWidth) x1 = displayWidth;
+    if (x1 <= x0) continue;
+
+    const uint8_t *src = data + (x0 - xMove) * rasterHeight + r;
+    uint8_t *upperByte = buffer + upper * displayWidth + x0;
+    uint8_t *lowerByte = buffer + lower * displayWidth + x0;
+    uint16_t columns   = x1 - x0;
+
+    if (hasUpper && hasLower) {
+      for (uint16_t x = 0; x < columns; x++, src += rasterHeight) {
+        uint8_t currentByte = pgm_read_byte(src);
+        oledDisplayBlitByte<C>(upperByte + x, currentByte << shift);
+        oledDisplayBlitByte<C>(lowerByte + x, currentByte >> (8 - shift));
+      }
+    } else if (hasUpper && shift == 0) {
+      // Page aligned, the raster bytes go to the buffer as they are
+      for (uint16_t x = 0; x < columns; x++, src += rasterHeight) {
+        oledDisplayBlitByte<C>(upperByte + x, pgm_read_byte(src));
+      }
+    } else if (hasUpper) {
+      for (uint16_t x = 0; x < columns; x++, src += rasterHeight) {
+        oledDisplayBlitByte<C>(upperByte + x, pgm_read_byte(src) << shift);
+      }
+    } else {
+      for (uint16_t x = 0; x < columns; x++, src += rasterHeight) {
+        oledDisplayBlitByte<C>(lowerByte + x, pgm_read_byte(src) >> (8 - shift));
+      }
+    }
+  }
+}
+
+inline void OLEDDisplay::blitRaster(OLEDDISPLAY_COLOR color, uint8_t *buffer, uint16_t displayWidth, uint16_t displayPages,
+                                    int16_t xMove, int16_t yMove, uint8_t rasterHeight,
+                                    const uint8_t *data, uint16_t bytesInData) {
+  switch (color) {
+    case WHITE:
+      blitRaster<WHITE>(buffer, displayWidth, displayPages, xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+    case BLACK:
+      blitRaster<BLACK>(buffer, displayWidth, displayPages, xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+    case INVERSE:
+      blitRaster<INVERSE>(buffer, displayWidth, displayPages, xMove, yMove, rasterHeight, data, bytesInData);
+      break;
+  }
+}
+
 #endif
@@ -0,0 +1,158 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef OLEDDISPLAYFIXED_h
+#define OLEDDISPLAYFIXED_h
+
+#include "OLEDDisplay.h"
+
+/*
+ * A display whose geometry is fixed at compile time, e.g.
+ *
+ *   OLEDDisplayFixed<SSD1306Wire, 128, 64> display(0x3c, SDA, SCL);
+ *
+ * The constructor arguments are passed on to the driver, the geometry is set
+ * from W and H. The framebuffers and the state of the dirty tracking and
+ * segment hashes are part of the object and attached with setBuffers(), a
+ * global display keeps them in static storage.
+ *
+ * setPixel(), setPixelColor(), clearPixel(), drawHorizontalLine() and
+ * drawFastImage() are replaced by versions that use W and H as constants, so
+ * the compiler can reduce the addressing to shifts and constant offsets.
+ * They are not virtual: calls through an OLEDDisplay pointer or reference, and
+ * the other drawing functions, use the generic implementations.
+ */
+template <class Driver, uint16_t W, uint16_t H>
+class OLEDDisplayFixed : public Driver {
+  static_assert(W > 0 && H > 0 && H % 8 == 0, "The height of the display has to be a multiple of 8");
+
+  public:
+    template <typename... Args>
+    OLEDDisplayFixed(Args... args) : Driver(args...) {
+      this->setGeometry(fixedGeometry(), W, H);
+      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+      this->setBuffers(frame, frameBack, fixedState());
+      #else
+      this->setBuffers(frame, NULL, fixedState());
+      #endif
+    }
+
+    uint16_t width(void) const { return W; }
+    uint16_t height(void) const { return H; }
+
+    void setPixel(int16_t x, int16_t y) {
+      setPixelColor(x, y, this->color);
+    }
+
+    void setPixelColor(int16_t x, int16_t y, OLEDDISPLAY_COLOR color) {
+      if ((uint16_t) x >= W || (uint16_t) y >= H) return;
+      this->touchRegion(x, x, y >> 3, y >> 3);
+      uint8_t *byte = this->buffer + x + (y >> 3) * W;
+      switch (color) {
+        case WHITE:   *byte |=  (1 << (y & 7)); break;
+        case BLACK:   *byte &= ~(1 << (y & 7)); break;
+        case INVERSE: *byte ^=  (1 << (y & 7)); break;
+      }
+    }
+
+    void clearPixel(int16_t x, int16_t y) {
+      switch (this->color) {
+        case BLACK:   setPixelColor(x, y, WHITE); break;
+        case WHITE:   setPixelColor(x, y, BLACK); break;
+        case INVERSE: setPixelColor(x, y, INVERSE); break;
+      }
+    }
+
+    void drawHorizontalLine(int16_t x, int16_t y, int16_t length) {
+      if ((uint16_t) y >= H) return;
+      if (x < 0) {
+        length += x;
+        x = 0;
+      }
+      if (x + length > W) length = W - x;
+      if (length <= 0) return;
+
+      this->touchRegion(x, x + length - 1, y >> 3, y >> 3);
+
+      uint8_t *bufferPtr = this->buffer + (y >> 3) * W + x;
+      uint8_t drawBit = 1 << (y & 7);
+      switch (this->color) {
+        case WHITE:   while (length--) *bufferPtr++ |= drawBit; break;
+        case BLACK:   drawBit = ~drawBit; while (length--) *bufferPtr++ &= drawBit; break;
+        case INVERSE: while (length--) *bufferPtr++ ^= drawBit; break;
+      }
+    }
+
+    void drawFastImage(int16_t xMove, int16_t yMove, int16_t width, int16_t height, const uint8_t *image) {
+      if (width < 0 || height < 0) return;
+      if (yMove + height < 0 || yMove > H) return;
+      if (xMove + width  < 0 || xMove > W) return;
+
+      uint8_t rasterHeight = 1 + ((height - 1) >> 3);
+      int16_t lastRow = yMove + rasterHeight * 8 - 1;
+      int16_t lastColumn = xMove + width - 1;
+      if (lastRow >= 0 && lastColumn >= 0 && yMove < H && xMove < W) {
+        this->touchRegion(xMove < 0 ? 0 : xMove, lastColumn < W ? lastColumn : W - 1,
+                          yMove < 0 ? 0 : yMove >> 3, lastRow < H ? lastRow >> 3 : (H - 1) >> 3);
+      }
+
+      OLEDDisplay::blitRaster(this->color, this->buffer, W, H / 8, xMove, yMove, rasterHeight, image, width * rasterHeight);
+#ifndef __MBED__
+      yield();
+#endif
+    }
+
+  private:
+    static constexpr OLEDDISPLAY_GEOMETRY fixedGeometry() {
+      return W == 128 && H == 64 ? GEOMETRY_128_64 :
+             W == 128 && H == 32 ? GEOMETRY_128_32 :
+             W == 64  && H == 48 ? GEOMETRY_64_48  :
+             W == 64  && H == 32 ? GEOMETRY_64_32  : GEOMETRY_RAWMODE;
+    }
+
+    uint8_t *fixedState() {
+      #if defined(OLEDDISPLAY_DIRTY_TRACKING) || defined(OLEDDISPLAY_SEGMENT_HASHES)
+      return state;
+      #else
+      return NULL;
+      #endif
+    }
+
+    uint8_t frame[OLEDDISPLAY_BUFFER_SIZE(W, H)] __attribute__((aligned(OLEDDISPLAY_BUFFER_ALIGNMENT)));
+    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
+    uint8_t frameBack[OLEDDISPLAY_BUFFER_SIZE(W, H)] __attribute__((aligned(OLEDDISPLAY_BUFFER_ALIGNMENT)));
+    #endif
+    #if defined(OLEDDISPLAY_DIRTY_TRACKING) || defined(OLEDDISPLAY_SEGMENT_HASHES)
+    uint8_t state[OLEDDISPLAY_STATE_SIZE(W, H)] __attribute__((aligned(OLEDDISPLAY_BUFFER_ALIGNMENT)));
+    #endif
+};
+
+#endif
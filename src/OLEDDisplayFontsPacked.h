@@ -0,0 +1,1287 @@
+// Generated by resources/fontConverter.py from OLEDDisplayFonts.h
+#ifndef OLEDDISPLAYFONTSPACKED_h
+#define OLEDDISPLAYFONTSPACKED_h
+
+#ifdef __MBED__
+#define PROGMEM
+#endif
+
+// ArialMT_Plain_10: 2392 bytes instead of 2731
+const uint8_t ArialMT_Plain_10_Packed[] PROGMEM = {
+  0x00, // Extended header
+  0x0D, // Height: 13
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+  0x01, // Flags: bit packed
+  0x0A, // Width: 10
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x03,  // 32:65535
+  0x00, 0x00, 0x05, 0x03,  // 33:0
+  0x00, 0x05, 0x05, 0x04,  // 34:5
+  0x00, 0x0A, 0x08, 0x06,  // 35:10
+  0x00, 0x12, 0x08, 0x06,  // 36:18
+  0x00, 0x1A, 0x0A, 0x09,  // 37:26
+  0x00, 0x24, 0x0A, 0x07,  // 38:36
+  0x00, 0x2E, 0x04, 0x02,  // 39:46
+  0x00, 0x32, 0x07, 0x03,  // 40:50
+  0x00, 0x39, 0x07, 0x03,  // 41:57
+  0x00, 0x40, 0x05, 0x04,  // 42:64
+  0x00, 0x45, 0x07, 0x06,  // 43:69
+  0x00, 0x4C, 0x04, 0x03,  // 44:76
+  0x00, 0x50, 0x04, 0x03,  // 45:80
+  0x00, 0x54, 0x04, 0x03,  // 46:84
+  0x00, 0x58, 0x06, 0x03,  // 47:88
+  0x00, 0x5E, 0x08, 0x06,  // 48:94
+  0x00, 0x66, 0x07, 0x06,  // 49:102
+  0x00, 0x6D, 0x08, 0x06,  // 50:109
+  0x00, 0x75, 0x08, 0x06,  // 51:117
+  0x00, 0x7D, 0x09, 0x06,  // 52:125
+  0x00, 0x86, 0x08, 0x06,  // 53:134
+  0x00, 0x8E, 0x08, 0x06,  // 54:142
+  0x00, 0x96, 0x08, 0x06,  // 55:150
+  0x00, 0x9E, 0x08, 0x06,  // 56:158
+  0x00, 0xA6, 0x08, 0x06,  // 57:166
+  0x00, 0xAE, 0x05, 0x03,  // 58:174
+  0x00, 0xB3, 0x05, 0x03,  // 59:179
+  0x00, 0xB8, 0x07, 0x06,  // 60:184
+  0x00, 0xBF, 0x05, 0x06,  // 61:191
+  0x00, 0xC4, 0x07, 0x06,  // 62:196
+  0x00, 0xCB, 0x09, 0x06,  // 63:203
+  0x00, 0xD4, 0x0F, 0x0A,  // 64:212
+  0x00, 0xE3, 0x0A, 0x07,  // 65:227
+  0x00, 0xED, 0x09, 0x07,  // 66:237
+  0x00, 0xF6, 0x09, 0x07,  // 67:246
+  0x00, 0xFF, 0x09, 0x07,  // 68:255
+  0x01, 0x08, 0x09, 0x07,  // 69:264
+  0x01, 0x11, 0x08, 0x06,  // 70:273
+  0x01, 0x19, 0x0A, 0x08,  // 71:281
+  0x01, 0x23, 0x09, 0x07,  // 72:291
+  0x01, 0x2C, 0x05, 0x03,  // 73:300
+  0x01, 0x31, 0x07, 0x05,  // 74:305
+  0x01, 0x38, 0x0A, 0x07,  // 75:312
+  0x01, 0x42, 0x09, 0x06,  // 76:322
+  0x01, 0x4B, 0x0A, 0x08,  // 77:331
+  0x01, 0x55, 0x09, 0x07,  // 78:341
+  0x01, 0x5E, 0x0A, 0x08,  // 79:350
+  0x01, 0x68, 0x09, 0x07,  // 80:360
+  0x01, 0x71, 0x0A, 0x08,  // 81:369
+  0x01, 0x7B, 0x09, 0x07,  // 82:379
+  0x01, 0x84, 0x09, 0x07,  // 83:388
+  0x01, 0x8D, 0x09, 0x06,  // 84:397
+  0x01, 0x96, 0x09, 0x07,  // 85:406
+  0x01, 0x9F, 0x0A, 0x07,  // 86:415
+  0x01, 0xA9, 0x0B, 0x09,  // 87:425
+  0x01, 0xB4, 0x0A, 0x07,  // 88:436
+  0x01, 0xBE, 0x0A, 0x07,  // 89:446
+  0x01, 0xC8, 0x09, 0x06,  // 90:456
+  0x01, 0xD1, 0x07, 0x03,  // 91:465
+  0x01, 0xD8, 0x06, 0x03,  // 92:472
+  0x01, 0xDE, 0x06, 0x03,  // 93:478
+  0x01, 0xE4, 0x06, 0x05,  // 94:484
+  0x01, 0xEA, 0x04, 0x06,  // 95:490
+  0x01, 0xEE, 0x04, 0x03,  // 96:494
+  0x01, 0xF2, 0x07, 0x06,  // 97:498
+  0x01, 0xF9, 0x08, 0x06,  // 98:505
+  0x02, 0x01, 0x07, 0x05,  // 99:513
+  0x02, 0x08, 0x08, 0x06,  // 100:520
+  0x02, 0x10, 0x07, 0x06,  // 101:528
+  0x02, 0x17, 0x06, 0x03,  // 102:535
+  0x02, 0x1D, 0x08, 0x06,  // 103:541
+  0x02, 0x25, 0x08, 0x06,  // 104:549
+  0x02, 0x2D, 0x05, 0x02,  // 105:557
+  0x02, 0x32, 0x06, 0x02,  // 106:562
+  0x02, 0x38, 0x07, 0x05,  // 107:568
+  0x02, 0x3F, 0x05, 0x02,  // 108:575
+  0x02, 0x44, 0x08, 0x08,  // 109:580
+  0x02, 0x4C, 0x07, 0x06,  // 110:588
+  0x02, 0x53, 0x07, 0x06,  // 111:595
+  0x02, 0x5A, 0x08, 0x06,  // 112:602
+  0x02, 0x62, 0x08, 0x06,  // 113:610
+  0x02, 0x6A, 0x05, 0x03,  // 114:618
+  0x02, 0x6F, 0x06, 0x05,  // 115:623
+  0x02, 0x75, 0x06, 0x03,  // 116:629
+  0x02, 0x7B, 0x07, 0x06,  // 117:635
+  0x02, 0x82, 0x07, 0x05,  // 118:642
+  0x02, 0x89, 0x08, 0x07,  // 119:649
+  0x02, 0x91, 0x07, 0x05,  // 120:657
+  0x02, 0x98, 0x08, 0x05,  // 121:664
+  0x02, 0xA0, 0x07, 0x05,  // 122:672
+  0x02, 0xA7, 0x07, 0x03,  // 123:679
+  0x02, 0xAE, 0x06, 0x03,  // 124:686
+  0x02, 0xB4, 0x07, 0x03,  // 125:692
+  0x02, 0xBB, 0x05, 0x06,  // 126:699
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x0A,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x03,  // 160:65535
+  0x02, 0xC0, 0x05, 0x03,  // 161:704
+  0x02, 0xC5, 0x09, 0x06,  // 162:709
+  0x02, 0xCE, 0x09, 0x06,  // 163:718
+  0x02, 0xD7, 0x06, 0x06,  // 164:727
+  0x02, 0xDD, 0x08, 0x06,  // 165:733
+  0x02, 0xE5, 0x06, 0x03,  // 166:741
+  0x02, 0xEB, 0x09, 0x06,  // 167:747
+  0x02, 0xF4, 0x04, 0x03,  // 168:756
+  0x02, 0xF8, 0x0A, 0x07,  // 169:760
+  0x03, 0x02, 0x05, 0x04,  // 170:770
+  0x03, 0x07, 0x06, 0x06,  // 171:775
+  0x03, 0x0D, 0x05, 0x06,  // 172:781
+  0x03, 0x12, 0x04, 0x03,  // 173:786
+  0x03, 0x16, 0x0A, 0x07,  // 174:790
+  0x03, 0x20, 0x04, 0x06,  // 175:800
+  0x03, 0x24, 0x05, 0x04,  // 176:804
+  0x03, 0x29, 0x07, 0x05,  // 177:809
+  0x03, 0x30, 0x05, 0x03,  // 178:816
+  0x03, 0x35, 0x05, 0x03,  // 179:821
+  0x03, 0x3A, 0x04, 0x03,  // 180:826
+  0x03, 0x3E, 0x08, 0x06,  // 181:830
+  0x03, 0x46, 0x09, 0x05,  // 182:838
+  0x03, 0x4F, 0x04, 0x03,  // 183:847
+  0x03, 0x53, 0x05, 0x03,  // 184:851
+  0x03, 0x58, 0x05, 0x03,  // 185:856
+  0x03, 0x5D, 0x05, 0x04,  // 186:861
+  0x03, 0x62, 0x06, 0x06,  // 187:866
+  0x03, 0x68, 0x0A, 0x08,  // 188:872
+  0x03, 0x72, 0x0A, 0x08,  // 189:882
+  0x03, 0x7C, 0x0A, 0x08,  // 190:892
+  0x03, 0x86, 0x08, 0x06,  // 191:902
+  0x03, 0x8E, 0x0C, 0x07,  // 192:910
+  0x03, 0x9A, 0x0C, 0x07,  // 193:922
+  0x03, 0xA6, 0x0C, 0x07,  // 194:934
+  0x03, 0xB2, 0x0C, 0x07,  // 195:946
+  0x03, 0xBE, 0x0B, 0x07,  // 196:958
+  0x03, 0xC9, 0x0B, 0x07,  // 197:969
+  0x03, 0xD4, 0x0B, 0x0A,  // 198:980
+  0x03, 0xDF, 0x0B, 0x07,  // 199:991
+  0x03, 0xEA, 0x0B, 0x07,  // 200:1002
+  0x03, 0xF5, 0x0B, 0x07,  // 201:1013
+  0x04, 0x00, 0x0B, 0x07,  // 202:1024
+  0x04, 0x0B, 0x0A, 0x07,  // 203:1035
+  0x04, 0x15, 0x07, 0x03,  // 204:1045
+  0x04, 0x1C, 0x06, 0x03,  // 205:1052
+  0x04, 0x22, 0x06, 0x03,  // 206:1058
+  0x04, 0x28, 0x07, 0x03,  // 207:1064
+  0x04, 0x2F, 0x09, 0x07,  // 208:1071
+  0x04, 0x38, 0x0B, 0x07,  // 209:1080
+  0x04, 0x43, 0x0C, 0x08,  // 210:1091
+  0x04, 0x4F, 0x0C, 0x08,  // 211:1103
+  0x04, 0x5B, 0x0C, 0x08,  // 212:1115
+  0x04, 0x67, 0x0C, 0x08,  // 213:1127
+  0x04, 0x73, 0x0B, 0x08,  // 214:1139
+  0x04, 0x7E, 0x07, 0x06,  // 215:1150
+  0x04, 0x85, 0x0A, 0x08,  // 216:1157
+  0x04, 0x8F, 0x0B, 0x07,  // 217:1167
+  0x04, 0x9A, 0x0B, 0x07,  // 218:1178
+  0x04, 0xA5, 0x0B, 0x07,  // 219:1189
+  0x04, 0xB0, 0x0A, 0x07,  // 220:1200
+  0x04, 0xBA, 0x0C, 0x07,  // 221:1210
+  0x04, 0xC6, 0x09, 0x07,  // 222:1222
+  0x04, 0xCF, 0x09, 0x06,  // 223:1231
+  0x04, 0xD8, 0x08, 0x06,  // 224:1240
+  0x04, 0xE0, 0x08, 0x06,  // 225:1248
+  0x04, 0xE8, 0x08, 0x06,  // 226:1256
+  0x04, 0xF0, 0x08, 0x06,  // 227:1264
+  0x04, 0xF8, 0x08, 0x06,  // 228:1272
+  0x05, 0x00, 0x09, 0x06,  // 229:1280
+  0x05, 0x09, 0x08, 0x09,  // 230:1289
+  0x05, 0x11, 0x08, 0x05,  // 231:1297
+  0x05, 0x19, 0x08, 0x06,  // 232:1305
+  0x05, 0x21, 0x08, 0x06,  // 233:1313
+  0x05, 0x29, 0x08, 0x06,  // 234:1321
+  0x05, 0x31, 0x08, 0x06,  // 235:1329
+  0x05, 0x39, 0x06, 0x03,  // 236:1337
+  0x05, 0x3F, 0x05, 0x03,  // 237:1343
+  0x05, 0x44, 0x06, 0x03,  // 238:1348
+  0x05, 0x4A, 0x06, 0x03,  // 239:1354
+  0x05, 0x50, 0x08, 0x06,  // 240:1360
+  0x05, 0x58, 0x08, 0x06,  // 241:1368
+  0x05, 0x60, 0x08, 0x06,  // 242:1376
+  0x05, 0x68, 0x08, 0x06,  // 243:1384
+  0x05, 0x70, 0x08, 0x06,  // 244:1392
+  0x05, 0x78, 0x08, 0x06,  // 245:1400
+  0x05, 0x80, 0x08, 0x06,  // 246:1408
+  0x05, 0x88, 0x07, 0x05,  // 247:1416
+  0x05, 0x8F, 0x07, 0x06,  // 248:1423
+  0x05, 0x96, 0x08, 0x06,  // 249:1430
+  0x05, 0x9E, 0x08, 0x06,  // 250:1438
+  0x05, 0xA6, 0x08, 0x06,  // 251:1446
+  0x05, 0xAE, 0x08, 0x06,  // 252:1454
+  0x05, 0xB6, 0x0A, 0x05,  // 253:1462
+  0x05, 0xC0, 0x09, 0x06,  // 254:1472
+  0x05, 0xC9, 0x09, 0x05,  // 255:1481
+  // Font Data:
+  0x02,0x03,0x07,0x80,0x2F,  // 33
+  0x03,0x03,0x03,0xC7,0x01,  // 34
+  0x05,0x03,0x07,0x74,0xCE,0x9D,0x73,0x01,  // 35
+  0x05,0x03,0x08,0x26,0x45,0xFF,0x49,0x32,  // 36
+  0x08,0x03,0x07,0x00,0x43,0xC2,0x8C,0xB1,0x25,0x61,  // 37
+  0x07,0x03,0x07,0x30,0x65,0xB3,0x3A,0x82,0x43,0x01,  // 38
+  0x01,0x03,0x03,0x07,  // 39
+  0x03,0x03,0x09,0x7C,0x04,0x05,0x04,  // 40
+  0x03,0x03,0x09,0x01,0x05,0xF1,0x01,  // 41
+  0x03,0x03,0x03,0x5D,0x01,  // 42
+  0x05,0x04,0x05,0x84,0x7C,0x42,0x00,  // 43
+  0x02,0x09,0x02,0x0C,  // 44
+  0x02,0x07,0x01,0x03,  // 45
+  0x02,0x09,0x01,0x02,  // 46
+  0x03,0x03,0x07,0x60,0xCE,0x00,  // 47
+  0x05,0x03,0x07,0xBE,0x60,0x30,0xE8,0x03,  // 48
+  0x04,0x03,0x07,0x00,0x82,0xE0,0x0F,  // 49
+  0x05,0x03,0x07,0xC2,0x70,0x34,0x69,0x04,  // 50
+  0x05,0x03,0x07,0xA2,0x60,0x32,0x69,0x03,  // 51
+  0x06,0x03,0x07,0x18,0x8A,0x24,0xF2,0x87,0x00,  // 52
+  0x05,0x03,0x07,0xAC,0x63,0xB1,0x98,0x03,  // 53
+  0x05,0x03,0x07,0xBE,0x62,0xB1,0xA8,0x03,  // 54
+  0x05,0x03,0x07,0x81,0x70,0xE6,0x10,0x00,  // 55
+  0x05,0x03,0x07,0xB6,0x64,0x32,0x69,0x03,  // 56
+  0x05,0x03,0x07,0xAE,0x68,0x34,0xEA,0x03,  // 57
+  0x02,0x05,0x05,0x20,0x02,  // 58
+  0x02,0x05,0x06,0x40,0x0C,  // 59
+  0x05,0x04,0x05,0x80,0x28,0x15,0x01,  // 60
+  0x05,0x05,0x03,0x6D,0x5B,  // 61
+  0x05,0x04,0x05,0x20,0x2A,0x45,0x00,  // 62
+  0x06,0x03,0x07,0x82,0x40,0x20,0x9B,0x30,0x00,  // 63
+  0x0A,0x03,0x09,0x00,0xF0,0x18,0xD2,0x59,0xB4,0x68,0xDE,0xA6,0xA2,0x38,0x01,  // 64
+  0x07,0x03,0x07,0x40,0x9C,0x25,0x62,0xC1,0x01,0x01,  // 65
+  0x06,0x03,0x07,0x80,0x7F,0x32,0x99,0xF4,0x01,  // 66
+  0x06,0x03,0x07,0x00,0x5F,0x30,0x18,0x14,0x01,  // 67
+  0x06,0x03,0x07,0x80,0x7F,0x30,0x28,0xE2,0x00,  // 68
+  0x06,0x03,0x07,0x80,0x7F,0x32,0x99,0x4C,0x02,  // 69
+  0x05,0x03,0x07,0x80,0x7F,0x22,0x11,0x00,  // 70
+  0x07,0x03,0x07,0x00,0x8E,0x28,0x98,0x54,0x61,0x00,  // 71
+  0x06,0x03,0x07,0x80,0x3F,0x02,0x81,0xF8,0x03,  // 72
+  0x02,0x03,0x07,0x80,0x3F,  // 73
+  0x04,0x03,0x07,0x60,0x20,0xF0,0x07,  // 74
+  0x07,0x03,0x07,0x80,0x3F,0x84,0x21,0x09,0x01,0x01,  // 75
+  0x06,0x03,0x07,0x80,0x3F,0x10,0x08,0x04,0x02,  // 76
+  0x08,0x03,0x07,0x80,0xBF,0x01,0x07,0xC4,0x19,0xFE,  // 77
+  0x06,0x03,0x07,0x80,0xBF,0x01,0x01,0xFB,0x03,  // 78
+  0x07,0x03,0x07,0x00,0x5F,0x30,0x18,0x0C,0xFA,0x00,  // 79
+  0x06,0x03,0x07,0x80,0x7F,0x22,0x91,0x30,0x00,  // 80
+  0x07,0x03,0x07,0x00,0x5F,0x30,0x18,0x0E,0x7B,0x01,  // 81
+  0x06,0x03,0x07,0x80,0x7F,0x22,0x91,0x31,0x03,  // 82
+  0x06,0x03,0x07,0x00,0x53,0x32,0x99,0x94,0x01,  // 83
+  0x06,0x03,0x07,0x80,0x40,0xE0,0x1F,0x08,0x00,  // 84
+  0x06,0x03,0x07,0x80,0x1F,0x10,0x08,0xFC,0x01,  // 85
+  0x07,0x03,0x07,0x01,0x07,0x0C,0x08,0x73,0x04,0x00,  // 86
+  0x09,0x03,0x07,0x03,0x1E,0xD0,0x17,0xF0,0x01,0x79,0x03,  // 87
+  0x07,0x03,0x07,0xC0,0x90,0x84,0x21,0x09,0x01,0x01,  // 88
+  0x07,0x03,0x07,0x01,0x01,0x01,0x4F,0x10,0x04,0x00,  // 89
+  0x06,0x03,0x07,0xE1,0x68,0xB6,0x79,0x1C,0x02,  // 90
+  0x03,0x03,0x09,0x00,0xFE,0x07,0x04,  // 91
+  0x03,0x03,0x07,0x03,0x0E,0x18,  // 92
+  0x02,0x03,0x09,0x01,0xFF,0x03,  // 93
+  0x05,0x03,0x04,0x68,0x61,0x08,  // 94
+  0x06,0x0B,0x01,0x3F,  // 95
+  0x02,0x03,0x02,0x09,  // 96
+  0x05,0x05,0x05,0x00,0xD7,0xFA,0x01,  // 97
+  0x05,0x03,0x07,0x80,0x3F,0x91,0x88,0x03,  // 98
+  0x05,0x05,0x05,0xC0,0xC5,0xA8,0x00,  // 99
+  0x05,0x03,0x07,0x00,0x1C,0x91,0xF8,0x07,  // 100
+  0x05,0x05,0x05,0xC0,0xD5,0x6A,0x01,  // 101
+  0x03,0x03,0x07,0x04,0x7F,0x01,  // 102
+  0x05,0x05,0x07,0x00,0x57,0x34,0xFA,0x03,  // 103
+  0x05,0x03,0x07,0x80,0x3F,0x81,0x80,0x07,  // 104
+  0x02,0x03,0x07,0x80,0x3E,  // 105
+  0x02,0x03,0x09,0x00,0xFB,0x01,  // 106
+  0x04,0x03,0x07,0x7F,0x08,0x8E,0x08,  // 107
+  0x02,0x03,0x07,0x80,0x3F,  // 108
+  0x08,0x05,0x05,0xE0,0x87,0xF0,0x43,0xF0,  // 109
+  0x05,0x05,0x05,0xE0,0x87,0xE0,0x01,  // 110
+  0x05,0x05,0x05,0xC0,0xC5,0xE8,0x00,  // 111
+  0x05,0x05,0x07,0x80,0x7F,0x24,0xE2,0x00,  // 112
+  0x05,0x05,0x07,0x00,0x47,0x24,0xF2,0x07,  // 113
+  0x03,0x05,0x05,0xE0,0x07,  // 114
+  0x04,0x05,0x05,0xB2,0xD6,0x04,  // 115
+  0x03,0x03,0x07,0x84,0x3F,0x11,  // 116
+  0x05,0x05,0x05,0xE0,0x41,0xF8,0x01,  // 117
+  0x05,0x05,0x05,0xC1,0x41,0x17,0x00,  // 118
+  0x07,0x05,0x05,0x0F,0xBA,0xE0,0xE0,0x03,  // 119
+  0x05,0x05,0x05,0x51,0x11,0x15,0x01,  // 120
+  0x05,0x05,0x07,0x01,0x27,0xCC,0x11,0x00,  // 121
+  0x05,0x05,0x05,0x31,0xD7,0x19,0x01,  // 122
+  0x03,0x03,0x09,0x10,0xDE,0x07,0x04,  // 123
+  0x02,0x03,0x09,0x00,0xFE,0x03,  // 124
+  0x03,0x03,0x09,0x01,0xDF,0x43,0x00,  // 125
+  0x05,0x06,0x02,0xB7,0x03,  // 126
+  0x02,0x05,0x07,0x80,0x3E,  // 161
+  0x05,0x03,0x09,0x00,0x70,0xD0,0x7F,0x82,0x02,  // 162
+  0x06,0x03,0x07,0x48,0x77,0x36,0x19,0x14,0x02,  // 163
+  0x05,0x05,0x04,0xF0,0x99,0x0F,  // 164
+  0x05,0x03,0x07,0x29,0x17,0xDE,0x95,0x02,  // 165
+  0x02,0x03,0x09,0x00,0xCE,0x03,  // 166
+  0x05,0x03,0x09,0x9A,0x4A,0xA6,0x4C,0x2A,0x0B,  // 167
+  0x03,0x03,0x01,0x05,  // 168
+  0x07,0x03,0x07,0x1C,0x51,0xB2,0x5A,0x15,0x71,0x00,  // 169
+  0x04,0x03,0x04,0xDD,0xFD,  // 170
+  0x05,0x06,0x04,0x60,0x69,0x09,  // 171
+  0x05,0x05,0x03,0x49,0x72,  // 172
+  0x02,0x07,0x01,0x03,  // 173
+  0x07,0x03,0x07,0x1C,0x51,0xB7,0x99,0x15,0x71,0x00,  // 174
+  0x06,0x01,0x01,0x3F,  // 175
+  0x04,0x03,0x03,0x78,0x0F,  // 176
+  0x05,0x04,0x06,0x24,0xF9,0x93,0x24,  // 177
+  0x03,0x03,0x04,0xD9,0x0B,  // 178
+  0x03,0x03,0x04,0xB9,0x0D,  // 179
+  0x03,0x03,0x02,0x18,  // 180
+  0x05,0x05,0x07,0x80,0x3F,0x04,0xF2,0x01,  // 181
+  0x05,0x03,0x09,0x0E,0xFE,0x07,0xF8,0x1F,0x00,  // 182
+  0x02,0x06,0x01,0x02,  // 183
+  0x03,0x0A,0x03,0xA8,0x01,  // 184
+  0x03,0x03,0x04,0x20,0x0F,  // 185
+  0x04,0x03,0x04,0x96,0x69,  // 186
+  0x05,0x06,0x04,0x90,0x96,0x06,  // 187
+  0x08,0x03,0x07,0x00,0xE1,0x0B,0x43,0x92,0xE5,0x41,  // 188
+  0x08,0x03,0x07,0x00,0xE1,0x0B,0xC2,0x50,0xA6,0xB1,  // 189
+  0x08,0x03,0x07,0x89,0x45,0x1B,0xC2,0x92,0xE5,0x41,  // 190
+  0x05,0x05,0x07,0x00,0x18,0xB2,0x09,0x02,  // 191
+  0x07,0x00,0x0A,0x00,0x02,0x07,0x4B,0x22,0xB2,0x00,0x07,0x20,  // 192
+  0x07,0x00,0x0A,0x00,0x02,0x07,0x8B,0x22,0xB1,0x00,0x07,0x20,  // 193
+  0x07,0x00,0x0A,0x00,0x02,0x27,0x4B,0x22,0xB2,0x00,0x07,0x20,  // 194
+  0x07,0x00,0x0A,0x00,0x0A,0x17,0x8B,0x22,0xB1,0x00,0x07,0x20,  // 195
+  0x07,0x01,0x09,0x00,0xC1,0x65,0x21,0x92,0x05,0x1C,0x40,  // 196
+  0x07,0x01,0x09,0x00,0xC1,0x7D,0x29,0xF2,0x05,0x1C,0x40,  // 197
+  0x09,0x03,0x07,0x60,0x0C,0x67,0x12,0xF9,0x27,0x93,0x49,  // 198
+  0x06,0x03,0x0A,0x00,0xF8,0x10,0x44,0xB0,0x41,0x8B,0x00,  // 199
+  0x06,0x00,0x0A,0x00,0xE0,0x9F,0xA4,0x92,0x48,0x22,0x09,  // 200
+  0x06,0x00,0x0A,0x00,0xE0,0x8F,0xA4,0x92,0x49,0x22,0x09,  // 201
+  0x06,0x00,0x0A,0x00,0xE8,0x9F,0xA4,0x92,0x48,0x22,0x09,  // 202
+  0x06,0x01,0x09,0x00,0xF8,0x97,0x24,0x59,0x92,0x24,  // 203
+  0x03,0x00,0x0A,0x00,0xE4,0x2F,0x00,  // 204
+  0x02,0x00,0x0A,0x02,0xE4,0x0F,  // 205
+  0x02,0x00,0x0A,0x01,0xE8,0x0F,  // 206
+  0x03,0x01,0x09,0x01,0xF8,0x07,0x00,  // 207
+  0x06,0x03,0x07,0x88,0x7F,0x32,0x29,0xE2,0x00,  // 208
+  0x06,0x00,0x0A,0x00,0xE8,0x1F,0x83,0x10,0x81,0xE1,0x0F,  // 209
+  0x07,0x00,0x0A,0x00,0xC0,0x87,0x60,0x82,0x0A,0x22,0x08,0x1F,  // 210
+  0x07,0x00,0x0A,0x00,0xC0,0x87,0xA0,0x82,0x09,0x22,0x08,0x1F,  // 211
+  0x07,0x00,0x0A,0x00,0xC0,0x87,0xA0,0x82,0x09,0x2A,0x08,0x1F,  // 212
+  0x07,0x00,0x0A,0x00,0xC0,0xA7,0x60,0x82,0x0A,0x26,0x08,0x1F,  // 213
+  0x07,0x01,0x09,0x00,0xF0,0x15,0x24,0x58,0x90,0x20,0x3E,  // 214
+  0x05,0x04,0x05,0x51,0x39,0x15,0x01,  // 215
+  0x07,0x03,0x07,0x00,0x6F,0x38,0x5B,0x1C,0x77,0x00,  // 216
+  0x06,0x00,0x0A,0x00,0xE0,0x17,0xA0,0x80,0x00,0xE2,0x07,  // 217
+  0x06,0x00,0x0A,0x00,0xE0,0x27,0x60,0x80,0x00,0xE2,0x07,  // 218
+  0x06,0x00,0x0A,0x00,0xE0,0x27,0x60,0x80,0x02,0xE2,0x07,  // 219
+  0x06,0x01,0x09,0x00,0xF8,0x05,0x04,0x18,0x90,0x1F,  // 220
+  0x07,0x00,0x0A,0x08,0x40,0x00,0x82,0xF0,0x21,0x40,0x80,0x00,  // 221
+  0x06,0x03,0x07,0x80,0xBF,0x48,0x24,0xE2,0x00,  // 222
+  0x06,0x03,0x07,0x00,0x7F,0x28,0x69,0x85,0x01,  // 223
+  0x05,0x02,0x08,0x00,0xC0,0xA9,0xAA,0xF8,  // 224
+  0x05,0x02,0x08,0x00,0xC0,0xAA,0xA9,0xF8,  // 225
+  0x05,0x02,0x08,0x00,0xC0,0xAA,0xA9,0xFA,  // 226
+  0x05,0x02,0x08,0x00,0xC2,0xA9,0xAA,0xF9,  // 227
+  0x05,0x03,0x07,0x00,0x70,0x95,0xDA,0x07,  // 228
+  0x05,0x01,0x09,0x00,0x00,0x5F,0xAD,0x7A,0x1F,  // 229
+  0x08,0x05,0x05,0x40,0xD7,0xEA,0x6A,0xB5,  // 230
+  0x05,0x05,0x08,0x00,0x0E,0xB1,0xD1,0x0A,  // 231
+  0x05,0x02,0x08,0x00,0x70,0xA9,0xAA,0xB0,  // 232
+  0x05,0x02,0x08,0x00,0x70,0xAA,0xA9,0xB0,  // 233
+  0x05,0x02,0x08,0x00,0x70,0xAA,0xA9,0xB2,  // 234
+  0x05,0x03,0x07,0x00,0x5C,0x95,0x9A,0x05,  // 235
+  0x03,0x02,0x08,0x00,0xF9,0x02,  // 236
+  0x02,0x02,0x08,0x02,0xF9,  // 237
+  0x03,0x02,0x08,0x02,0xF9,0x02,  // 238
+  0x03,0x03,0x07,0x01,0x7E,0x00,  // 239
+  0x05,0x03,0x07,0x00,0x5C,0xF1,0xC8,0x03,  // 240
+  0x05,0x02,0x08,0x00,0xFA,0x09,0x0A,0xF1,  // 241
+  0x05,0x02,0x08,0x00,0x70,0x89,0x8A,0x70,  // 242
+  0x05,0x02,0x08,0x00,0x70,0x8A,0x89,0x70,  // 243
+  0x05,0x02,0x08,0x00,0x70,0x8A,0x89,0x72,  // 244
+  0x05,0x02,0x08,0x00,0x72,0x89,0x8A,0x71,  // 245
+  0x05,0x03,0x07,0x00,0x5C,0x91,0x98,0x03,  // 246
+  0x05,0x04,0x05,0x84,0x54,0x42,0x00,  // 247
+  0x05,0x05,0x05,0xC0,0xF6,0xD9,0x00,  // 248
+  0x05,0x02,0x08,0x00,0x78,0x81,0x82,0xF8,  // 249
+  0x05,0x02,0x08,0x00,0x78,0x82,0x81,0xF8,  // 250
+  0x05,0x02,0x08,0x00,0x7A,0x81,0x82,0xF8,  // 251
+  0x05,0x03,0x07,0x00,0x5E,0x10,0xD8,0x07,  // 252
+  0x05,0x02,0x0A,0x08,0xC0,0x29,0x58,0x1C,0x08,0x00,  // 253
+  0x05,0x03,0x09,0x00,0xFE,0x13,0x21,0x82,0x03,  // 254
+  0x05,0x03,0x09,0x04,0x72,0x02,0xCB,0x41,0x00,  // 255
+};
+
+// ArialMT_Plain_16: 3592 bytes instead of 5049
+const uint8_t ArialMT_Plain_16_Packed[] PROGMEM = {
+  0x00, // Extended header
+  0x13, // Height: 19
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+  0x01, // Flags: bit packed
+  0x10, // Width: 16
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x04,  // 32:65535
+  0x00, 0x00, 0x08, 0x04,  // 33:0
+  0x00, 0x08, 0x06, 0x06,  // 34:8
+  0x00, 0x0E, 0x11, 0x09,  // 35:14
+  0x00, 0x1F, 0x11, 0x09,  // 36:31
+  0x00, 0x30, 0x17, 0x0E,  // 37:48
+  0x00, 0x47, 0x12, 0x0B,  // 38:71
+  0x00, 0x59, 0x04, 0x03,  // 39:89
+  0x00, 0x5D, 0x0B, 0x05,  // 40:93
+  0x00, 0x68, 0x0B, 0x05,  // 41:104
+  0x00, 0x73, 0x07, 0x06,  // 42:115
+  0x00, 0x7A, 0x0A, 0x09,  // 43:122
+  0x00, 0x84, 0x05, 0x04,  // 44:132
+  0x00, 0x89, 0x04, 0x05,  // 45:137
+  0x00, 0x8D, 0x04, 0x04,  // 46:141
+  0x00, 0x91, 0x09, 0x04,  // 47:145
+  0x00, 0x9A, 0x0F, 0x09,  // 48:154
+  0x00, 0xA9, 0x0C, 0x09,  // 49:169
+  0x00, 0xB5, 0x0F, 0x09,  // 50:181
+  0x00, 0xC4, 0x0F, 0x09,  // 51:196
+  0x00, 0xD3, 0x0F, 0x09,  // 52:211
+  0x00, 0xE2, 0x0F, 0x09,  // 53:226
+  0x00, 0xF1, 0x0F, 0x09,  // 54:241
+  0x01, 0x00, 0x0F, 0x09,  // 55:256
+  0x01, 0x0F, 0x0F, 0x09,  // 56:271
+  0x01, 0x1E, 0x0F, 0x09,  // 57:286
+  0x01, 0x2D, 0x06, 0x04,  // 58:301
+  0x01, 0x33, 0x06, 0x04,  // 59:307
+  0x01, 0x39, 0x0A, 0x09,  // 60:313
+  0x01, 0x43, 0x08, 0x09,  // 61:323
+  0x01, 0x4B, 0x0A, 0x09,  // 62:331
+  0x01, 0x55, 0x0F, 0x09,  // 63:341
+  0x01, 0x64, 0x21, 0x10,  // 64:356
+  0x01, 0x85, 0x12, 0x0B,  // 65:389
+  0x01, 0x97, 0x12, 0x0B,  // 66:407
+  0x01, 0xA9, 0x14, 0x0C,  // 67:425
+  0x01, 0xBD, 0x14, 0x0C,  // 68:445
+  0x01, 0xD1, 0x12, 0x0B,  // 69:465
+  0x01, 0xE3, 0x11, 0x0A,  // 70:483
+  0x01, 0xF4, 0x14, 0x0C,  // 71:500
+  0x02, 0x08, 0x12, 0x0C,  // 72:520
+  0x02, 0x1A, 0x06, 0x04,  // 73:538
+  0x02, 0x20, 0x0E, 0x08,  // 74:544
+  0x02, 0x2E, 0x12, 0x0B,  // 75:558
+  0x02, 0x40, 0x0F, 0x09,  // 76:576
+  0x02, 0x4F, 0x15, 0x0D,  // 77:591
+  0x02, 0x64, 0x12, 0x0C,  // 78:612
+  0x02, 0x76, 0x14, 0x0C,  // 79:630
+  0x02, 0x8A, 0x12, 0x0B,  // 80:650
+  0x02, 0x9C, 0x14, 0x0C,  // 81:668
+  0x02, 0xB0, 0x12, 0x0C,  // 82:688
+  0x02, 0xC2, 0x12, 0x0B,  // 83:706
+  0x02, 0xD4, 0x11, 0x0A,  // 84:724
+  0x02, 0xE5, 0x12, 0x0C,  // 85:741
+  0x02, 0xF7, 0x12, 0x0B,  // 86:759
+  0x03, 0x09, 0x1A, 0x0F,  // 87:777
+  0x03, 0x23, 0x14, 0x0B,  // 88:803
+  0x03, 0x37, 0x11, 0x0B,  // 89:823
+  0x03, 0x48, 0x11, 0x0A,  // 90:840
+  0x03, 0x59, 0x0B, 0x04,  // 91:857
+  0x03, 0x64, 0x09, 0x04,  // 92:868
+  0x03, 0x6D, 0x09, 0x04,  // 93:877
+  0x03, 0x76, 0x09, 0x08,  // 94:886
+  0x03, 0x7F, 0x05, 0x09,  // 95:895
+  0x03, 0x84, 0x04, 0x05,  // 96:900
+  0x03, 0x88, 0x0C, 0x09,  // 97:904
+  0x03, 0x94, 0x0F, 0x09,  // 98:916
+  0x03, 0xA3, 0x0B, 0x08,  // 99:931
+  0x03, 0xAE, 0x0F, 0x09,  // 100:942
+  0x03, 0xBD, 0x0C, 0x09,  // 101:957
+  0x03, 0xC9, 0x09, 0x04,  // 102:969
+  0x03, 0xD2, 0x0F, 0x09,  // 103:978
+  0x03, 0xE1, 0x0E, 0x09,  // 104:993
+  0x03, 0xEF, 0x06, 0x04,  // 105:1007
+  0x03, 0xF5, 0x07, 0x04,  // 106:1013
+  0x03, 0xFC, 0x0F, 0x08,  // 107:1020
+  0x04, 0x0B, 0x06, 0x04,  // 108:1035
+  0x04, 0x11, 0x11, 0x0D,  // 109:1041
+  0x04, 0x22, 0x0B, 0x09,  // 110:1058
+  0x04, 0x2D, 0x0C, 0x09,  // 111:1069
+  0x04, 0x39, 0x0F, 0x09,  // 112:1081
+  0x04, 0x48, 0x0F, 0x09,  // 113:1096
+  0x04, 0x57, 0x09, 0x05,  // 114:1111
+  0x04, 0x60, 0x0B, 0x08,  // 115:1120
+  0x04, 0x6B, 0x09, 0x04,  // 116:1131
+  0x04, 0x74, 0x0B, 0x09,  // 117:1140
+  0x04, 0x7F, 0x0B, 0x08,  // 118:1151
+  0x04, 0x8A, 0x10, 0x0C,  // 119:1162
+  0x04, 0x9A, 0x0B, 0x08,  // 120:1178
+  0x04, 0xA5, 0x0E, 0x08,  // 121:1189
+  0x04, 0xB3, 0x0B, 0x08,  // 122:1203
+  0x04, 0xBE, 0x0D, 0x05,  // 123:1214
+  0x04, 0xCB, 0x07, 0x04,  // 124:1227
+  0x04, 0xD2, 0x0D, 0x05,  // 125:1234
+  0x04, 0xDF, 0x05, 0x09,  // 126:1247
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x10,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x04,  // 160:65535
+  0x04, 0xE4, 0x08, 0x05,  // 161:1252
+  0x04, 0xEC, 0x12, 0x09,  // 162:1260
+  0x04, 0xFE, 0x0F, 0x09,  // 163:1278
+  0x05, 0x0D, 0x09, 0x09,  // 164:1293
+  0x05, 0x16, 0x11, 0x09,  // 165:1302
+  0x05, 0x27, 0x07, 0x04,  // 166:1319
+  0x05, 0x2E, 0x12, 0x09,  // 167:1326
+  0x05, 0x40, 0x04, 0x05,  // 168:1344
+  0x05, 0x44, 0x15, 0x0C,  // 169:1348
+  0x05, 0x59, 0x07, 0x06,  // 170:1369
+  0x05, 0x60, 0x0A, 0x09,  // 171:1376
+  0x05, 0x6A, 0x08, 0x09,  // 172:1386
+  0x05, 0x72, 0x04, 0x05,  // 173:1394
+  0x05, 0x76, 0x15, 0x0C,  // 174:1398
+  0x05, 0x8B, 0x05, 0x09,  // 175:1419
+  0x05, 0x90, 0x06, 0x06,  // 176:1424
+  0x05, 0x96, 0x0D, 0x09,  // 177:1430
+  0x05, 0xA3, 0x07, 0x05,  // 178:1443
+  0x05, 0xAA, 0x07, 0x05,  // 179:1450
+  0x05, 0xB1, 0x04, 0x05,  // 180:1457
+  0x05, 0xB5, 0x0F, 0x09,  // 181:1461
+  0x05, 0xC4, 0x14, 0x09,  // 182:1476
+  0x05, 0xD8, 0x04, 0x05,  // 183:1496
+  0x05, 0xDC, 0x05, 0x05,  // 184:1500
+  0x05, 0xE1, 0x06, 0x05,  // 185:1505
+  0x05, 0xE7, 0x07, 0x06,  // 186:1511
+  0x05, 0xEE, 0x0A, 0x09,  // 187:1518
+  0x05, 0xF8, 0x17, 0x0D,  // 188:1528
+  0x06, 0x0F, 0x17, 0x0D,  // 189:1551
+  0x06, 0x26, 0x17, 0x0D,  // 190:1574
+  0x06, 0x3D, 0x11, 0x0A,  // 191:1597
+  0x06, 0x4E, 0x16, 0x0B,  // 192:1614
+  0x06, 0x64, 0x16, 0x0B,  // 193:1636
+  0x06, 0x7A, 0x16, 0x0B,  // 194:1658
+  0x06, 0x90, 0x16, 0x0B,  // 195:1680
+  0x06, 0xA6, 0x15, 0x0B,  // 196:1702
+  0x06, 0xBB, 0x15, 0x0B,  // 197:1723
+  0x06, 0xD0, 0x1A, 0x10,  // 198:1744
+  0x06, 0xEA, 0x18, 0x0C,  // 199:1770
+  0x07, 0x02, 0x16, 0x0B,  // 200:1794
+  0x07, 0x18, 0x16, 0x0B,  // 201:1816
+  0x07, 0x2E, 0x16, 0x0B,  // 202:1838
+  0x07, 0x44, 0x15, 0x0B,  // 203:1860
+  0x07, 0x59, 0x07, 0x04,  // 204:1881
+  0x07, 0x60, 0x09, 0x04,  // 205:1888
+  0x07, 0x69, 0x0B, 0x04,  // 206:1897
+  0x07, 0x74, 0x09, 0x04,  // 207:1908
+  0x07, 0x7D, 0x14, 0x0C,  // 208:1917
+  0x07, 0x91, 0x16, 0x0C,  // 209:1937
+  0x07, 0xA7, 0x18, 0x0C,  // 210:1959
+  0x07, 0xBF, 0x18, 0x0C,  // 211:1983
+  0x07, 0xD7, 0x18, 0x0C,  // 212:2007
+  0x07, 0xEF, 0x18, 0x0C,  // 213:2031
+  0x08, 0x07, 0x17, 0x0C,  // 214:2055
+  0x08, 0x1E, 0x0A, 0x09,  // 215:2078
+  0x08, 0x28, 0x14, 0x0C,  // 216:2088
+  0x08, 0x3C, 0x16, 0x0C,  // 217:2108
+  0x08, 0x52, 0x16, 0x0C,  // 218:2130
+  0x08, 0x68, 0x16, 0x0C,  // 219:2152
+  0x08, 0x7E, 0x15, 0x0C,  // 220:2174
+  0x08, 0x93, 0x14, 0x0B,  // 221:2195
+  0x08, 0xA7, 0x12, 0x0B,  // 222:2215
+  0x08, 0xB9, 0x0F, 0x0A,  // 223:2233
+  0x08, 0xC8, 0x0F, 0x09,  // 224:2248
+  0x08, 0xD7, 0x0F, 0x09,  // 225:2263
+  0x08, 0xE6, 0x0F, 0x09,  // 226:2278
+  0x08, 0xF5, 0x0F, 0x09,  // 227:2293
+  0x09, 0x04, 0x0E, 0x09,  // 228:2308
+  0x09, 0x12, 0x10, 0x09,  // 229:2322
+  0x09, 0x22, 0x13, 0x0E,  // 230:2338
+  0x09, 0x35, 0x0E, 0x08,  // 231:2357
+  0x09, 0x43, 0x0F, 0x09,  // 232:2371
+  0x09, 0x52, 0x0F, 0x09,  // 233:2386
+  0x09, 0x61, 0x0F, 0x09,  // 234:2401
+  0x09, 0x70, 0x0E, 0x09,  // 235:2416
+  0x09, 0x7E, 0x06, 0x04,  // 236:2430
+  0x09, 0x84, 0x08, 0x04,  // 237:2436
+  0x09, 0x8C, 0x09, 0x04,  // 238:2444
+  0x09, 0x95, 0x08, 0x04,  // 239:2453
+  0x09, 0x9D, 0x0F, 0x09,  // 240:2461
+  0x09, 0xAC, 0x0E, 0x09,  // 241:2476
+  0x09, 0xBA, 0x0F, 0x09,  // 242:2490
+  0x09, 0xC9, 0x0F, 0x09,  // 243:2505
+  0x09, 0xD8, 0x0F, 0x09,  // 244:2520
+  0x09, 0xE7, 0x0F, 0x09,  // 245:2535
+  0x09, 0xF6, 0x0E, 0x09,  // 246:2550
+  0x0A, 0x04, 0x08, 0x09,  // 247:2564
+  0x0A, 0x0C, 0x0C, 0x0A,  // 248:2572
+  0x0A, 0x18, 0x0E, 0x09,  // 249:2584
+  0x0A, 0x26, 0x0E, 0x09,  // 250:2598
+  0x0A, 0x34, 0x0E, 0x09,  // 251:2612
+  0x0A, 0x42, 0x0D, 0x09,  // 252:2626
+  0x0A, 0x4F, 0x11, 0x08,  // 253:2639
+  0x0A, 0x60, 0x12, 0x09,  // 254:2656
+  0x0A, 0x72, 0x10, 0x08,  // 255:2674
+  // Font Data:
+  0x03,0x03,0x0C,0x00,0x00,0x00,0xFF,0x0B,  // 33
+  0x05,0x03,0x04,0xF0,0x00,0x0F,  // 34
+  0x09,0x03,0x0C,0x10,0x01,0xF1,0xF8,0x71,0x11,0x10,0x01,0xF1,0xF8,0x71,0x11,0x10,0x01,  // 35
+  0x08,0x02,0x0E,0x00,0x00,0x0E,0x41,0x84,0x08,0x41,0xFF,0xBF,0x20,0x44,0x88,0x20,0x1C,  // 36
+  0x0D,0x03,0x0C,0x00,0xE0,0x01,0x21,0x10,0x02,0x21,0xEC,0x31,0xC0,0x80,0x03,0x86,0x17,0x84,0x40,0x08,0x84,0x80,0x07,  // 37
+  0x0A,0x03,0x0C,0x00,0x00,0x38,0x4E,0x14,0x83,0x61,0x18,0x89,0x0E,0x05,0x20,0x00,0x05,0x88,  // 38
+  0x02,0x03,0x04,0xF0,  // 39
+  0x04,0x03,0x0F,0x00,0x00,0xF8,0x83,0x03,0x2E,0x00,0x08,  // 40
+  0x04,0x03,0x0F,0x00,0x80,0x00,0xA0,0x03,0x0E,0xFE,0x00,  // 41
+  0x05,0x03,0x05,0x42,0x1F,0x2D,0x00,  // 42
+  0x08,0x06,0x07,0x00,0x04,0x02,0xF1,0x47,0x20,0x10,  // 43
+  0x03,0x0E,0x03,0xC0,0x01,  // 44
+  0x04,0x0B,0x01,0x0F,  // 45
+  0x03,0x0E,0x01,0x04,  // 46
+  0x04,0x03,0x0C,0x00,0x0C,0x3C,0x3C,0x30,0x00,  // 47
+  0x08,0x03,0x0C,0x00,0xC0,0x3F,0x02,0x14,0x80,0x01,0x18,0x80,0x02,0xC4,0x3F,  // 48
+  0x06,0x03,0x0C,0x00,0x00,0x00,0x08,0x40,0x00,0x02,0xF0,0xFF,  // 49
+  0x08,0x03,0x0C,0x00,0x40,0x80,0x02,0x1C,0xA0,0x01,0x19,0x88,0x62,0xC8,0x81,  // 50
+  0x08,0x03,0x0C,0x00,0x40,0x20,0x02,0x14,0x82,0x21,0x18,0x83,0x5E,0x04,0x38,  // 51
+  0x08,0x03,0x0C,0x80,0x01,0x14,0x20,0x81,0x11,0x04,0x21,0x10,0xFF,0x0F,0x10,  // 52
+  0x08,0x03,0x0C,0x00,0x80,0x23,0x17,0x14,0x81,0x11,0x18,0x81,0x21,0x14,0x3C,  // 53
+  0x08,0x03,0x0C,0x00,0xC0,0x3F,0x22,0x14,0x81,0x11,0x18,0x81,0x22,0x44,0x3C,  // 54
+  0x08,0x03,0x0C,0x00,0x10,0x00,0x01,0x10,0xF0,0xE1,0x90,0x01,0x05,0x30,0x00,  // 55
+  0x08,0x03,0x0C,0x00,0xC0,0x38,0x52,0x14,0x82,0x21,0x18,0x82,0x52,0xC4,0x38,  // 56
+  0x08,0x03,0x0C,0x00,0xC0,0x23,0x42,0x14,0x88,0x81,0x18,0x88,0x42,0xC4,0x3F,  // 57
+  0x02,0x06,0x09,0x00,0x02,0x02,  // 58
+  0x02,0x06,0x0B,0x00,0x08,0x38,  // 59
+  0x08,0x06,0x07,0x00,0x04,0x85,0x22,0x12,0x89,0x82,  // 60
+  0x08,0x07,0x05,0x20,0xC6,0x18,0x63,0x8C,  // 61
+  0x08,0x06,0x07,0x80,0xA0,0x48,0x24,0xA2,0x50,0x10,  // 62
+  0x08,0x03,0x0C,0x00,0xC0,0x00,0x02,0x10,0x00,0x81,0x1B,0x04,0x22,0xC0,0x01,  // 63
+  0x10,0x03,0x0F,0x00,0x00,0xF0,0x03,0x06,0x82,0x00,0x22,0x3C,0x12,0x21,0x45,0x20,0x13,0x90,0x09,0xC8,0x04,0x62,0xE4,0x33,0x0F,0x29,0x80,0x14,0x20,0x31,0x88,0xE0,0x23,  // 64
+  0x0A,0x03,0x0C,0x00,0x00,0xC0,0x80,0x03,0x0F,0x8E,0x10,0x08,0x8E,0x00,0x0F,0x80,0x03,0xC0,  // 65
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x52,0xC4,0x38,  // 66
+  0x0B,0x03,0x0C,0x00,0x80,0x1F,0x04,0x22,0x40,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0x28,0x40,0x04,0x02,  // 67
+  0x0B,0x03,0x0C,0x00,0xF0,0xFF,0x01,0x18,0x80,0x01,0x18,0x80,0x01,0x18,0x80,0x02,0x44,0x20,0xF8,0x01,  // 68
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x18,0x80,  // 69
+  0x09,0x03,0x0C,0x00,0xF0,0xFF,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x01,0x00,  // 70
+  0x0B,0x03,0x0C,0x00,0x80,0x1F,0x04,0x22,0x40,0x01,0x18,0x80,0x41,0x18,0x84,0x42,0x44,0x24,0xC0,0x01,  // 71
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0x00,0x02,0x20,0xF0,0xFF,  // 72
+  0x02,0x03,0x0C,0x00,0xF0,0xFF,  // 73
+  0x07,0x03,0x0C,0x00,0x00,0x70,0x00,0x08,0x80,0x00,0x08,0x80,0xFF,0x07,  // 74
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x80,0x00,0x04,0x20,0x00,0x07,0x88,0x40,0x30,0x02,0x14,0x80,  // 75
+  0x08,0x03,0x0C,0x00,0xF0,0xFF,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0x08,0x80,  // 76
+  0x0C,0x03,0x0C,0x00,0xF0,0xFF,0x06,0x80,0x01,0x60,0x00,0x38,0x00,0x0C,0x38,0x60,0x80,0x01,0x06,0xF0,0xFF,  // 77
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x02,0xC0,0x00,0x10,0x00,0x06,0x80,0x00,0x30,0x00,0xF4,0xFF,  // 78
+  0x0B,0x03,0x0C,0x00,0x80,0x1F,0x04,0x22,0x40,0x01,0x18,0x80,0x01,0x18,0x80,0x02,0x44,0x20,0xF8,0x01,  // 79
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x41,0x10,0x04,0x41,0x10,0x04,0x41,0x10,0x04,0x22,0xC0,0x01,  // 80
+  0x0B,0x03,0x0C,0x00,0x80,0x1F,0x04,0x22,0x40,0x01,0x18,0x80,0x01,0x1A,0xA0,0x02,0x44,0xE0,0xF8,0x09,  // 81
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x41,0x10,0x04,0x41,0x10,0x04,0xC1,0x10,0x34,0x22,0xC4,0x81,  // 82
+  0x0A,0x03,0x0C,0x00,0xC0,0x20,0x12,0x14,0x82,0x21,0x18,0x82,0x41,0x18,0x84,0x42,0x44,0x38,  // 83
+  0x09,0x03,0x0C,0x01,0x10,0x00,0x01,0x10,0x00,0xFF,0x1F,0x00,0x01,0x10,0x00,0x01,0x00,  // 84
+  0x0A,0x03,0x0C,0x00,0xF0,0x3F,0x00,0x04,0x80,0x00,0x08,0x80,0x00,0x08,0x80,0x00,0xF4,0x3F,  // 85
+  0x0A,0x03,0x0C,0x00,0x30,0x00,0x1C,0x00,0x0E,0x00,0x03,0xC0,0x00,0x03,0x0E,0x1C,0x30,0x00,  // 86
+  0x0F,0x03,0x0C,0x03,0xC0,0x03,0xC0,0x03,0xC0,0x80,0x03,0x07,0x0E,0x10,0x00,0x0E,0x00,0x07,0x80,0x03,0xC0,0xC0,0xC3,0x03,0x03,0x00,  // 87
+  0x0B,0x03,0x0C,0x00,0x18,0x40,0x02,0xC2,0x18,0x50,0x00,0x02,0x50,0xC0,0x18,0x02,0x12,0x40,0x00,0x08,  // 88
+  0x09,0x03,0x0C,0x01,0x60,0x00,0x08,0x00,0x03,0xC0,0x0F,0x03,0x08,0x60,0x00,0x01,0x00,  // 89
+  0x09,0x03,0x0C,0x00,0x18,0xC0,0x01,0x1B,0x88,0x61,0x18,0x81,0x0D,0x38,0x80,0x01,0x08,  // 90
+  0x04,0x03,0x0F,0x00,0x80,0xFF,0x7F,0x00,0x30,0x00,0x08,  // 91
+  0x04,0x03,0x0C,0x03,0xC0,0x03,0xC0,0x03,0xC0,  // 92
+  0x03,0x03,0x0F,0x01,0xC0,0x00,0xE0,0xFF,0x1F,  // 93
+  0x07,0x03,0x06,0x20,0x66,0x04,0x06,0x06,0x02,  // 94
+  0x09,0x11,0x01,0xFF,0x01,  // 95
+  0x03,0x03,0x02,0x24,  // 96
+  0x08,0x06,0x09,0x00,0xC8,0x49,0x8C,0x18,0x31,0x61,0x22,0xFF,  // 97
+  0x08,0x03,0x0C,0x00,0xF0,0xFF,0x10,0x84,0x80,0x08,0x88,0x80,0x10,0x04,0x3E,  // 98
+  0x07,0x06,0x09,0x00,0xF8,0x08,0x0A,0x18,0x30,0xA0,0x20,  // 99
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x10,0x84,0x80,0x08,0x88,0x80,0x10,0xF4,0xFF,  // 100
+  0x08,0x06,0x09,0x00,0xF8,0x48,0x8A,0x18,0x31,0xA2,0x24,0x2E,  // 101
+  0x04,0x03,0x0C,0x08,0xE0,0xFF,0x09,0x90,0x00,  // 102
+  0x08,0x06,0x0C,0x00,0xC0,0x47,0x82,0x18,0x90,0x01,0x19,0x90,0x82,0xF4,0x3F,  // 103
+  0x07,0x03,0x0C,0x00,0xF0,0xFF,0x10,0x80,0x00,0x08,0x80,0x00,0xF0,0x0F,  // 104
+  0x02,0x03,0x0C,0x00,0x90,0xFF,  // 105
+  0x02,0x03,0x0F,0x00,0xC0,0xFC,0x1F,  // 106
+  0x08,0x03,0x0C,0x00,0xF0,0xFF,0x00,0x01,0x08,0xC0,0x00,0x32,0x10,0x84,0x80,  // 107
+  0x02,0x03,0x0C,0x00,0xF0,0xFF,  // 108
+  0x0C,0x06,0x09,0x00,0xFE,0x0B,0x08,0x10,0x20,0x80,0x7F,0x01,0x01,0x02,0x04,0xF0,0x0F,  // 109
+  0x07,0x06,0x09,0x00,0xFE,0x0B,0x08,0x10,0x20,0x80,0x7F,  // 110
+  0x08,0x06,0x09,0x00,0xF8,0x08,0x0A,0x18,0x30,0xA0,0x20,0x3E,  // 111
+  0x08,0x06,0x0C,0x00,0xF0,0xFF,0x82,0x10,0x10,0x01,0x11,0x10,0x82,0xC0,0x07,  // 112
+  0x08,0x06,0x0C,0x00,0xC0,0x07,0x82,0x10,0x10,0x01,0x11,0x10,0x82,0xF0,0xFF,  // 113
+  0x05,0x06,0x09,0x00,0xFE,0x0B,0x08,0x10,0x00,  // 114
+  0x07,0x06,0x09,0x00,0x1C,0x45,0x8C,0x18,0x31,0xA2,0x38,  // 115
+  0x04,0x04,0x0B,0x04,0xF8,0x3F,0x01,0x09,0x08,  // 116
+  0x07,0x06,0x09,0x00,0xFE,0x01,0x04,0x08,0x10,0xD0,0x7F,  // 117
+  0x07,0x06,0x09,0x03,0x18,0xC0,0x01,0x0C,0x87,0xC1,0x00,  // 118
+  0x0B,0x06,0x09,0x03,0xF8,0x00,0x86,0xC3,0x60,0x00,0x03,0x38,0x80,0xF9,0x0C,0x00,  // 119
+  0x07,0x06,0x09,0x01,0x05,0xB1,0x81,0xC0,0x46,0x50,0x40,  // 120
+  0x07,0x06,0x0C,0x07,0x80,0x81,0xE0,0x08,0x78,0xE0,0xC0,0x01,0x03,0x00,  // 121
+  0x07,0x06,0x09,0x01,0x03,0x87,0x8D,0xD8,0x70,0x60,0x40,  // 122
+  0x05,0x03,0x0F,0x80,0x00,0x40,0x80,0xDF,0x2F,0x00,0x18,0x00,0x04,  // 123
+  0x02,0x03,0x0F,0x00,0x80,0xFF,0x3F,  // 124
+  0x05,0x03,0x0F,0x01,0xC0,0x00,0xA0,0xDF,0x0F,0x10,0x00,0x08,0x00,  // 125
+  0x08,0x08,0x02,0x56,0x6A,  // 126
+  0x03,0x06,0x0C,0x00,0x00,0x00,0xFD,0x0F,  // 161
+  0x08,0x03,0x0F,0x00,0x00,0xF0,0x01,0x04,0x19,0xC1,0x83,0x9C,0xC0,0x41,0x5C,0x10,0x40,0x04,  // 162
+  0x08,0x03,0x0C,0x20,0xC8,0x63,0xE2,0x15,0x42,0x21,0x14,0x80,0x02,0x48,0x40,  // 163
+  0x07,0x06,0x06,0x40,0x2B,0x85,0xA1,0xD4,0x02,  // 164
+  0x09,0x03,0x0C,0x41,0x21,0x14,0x4C,0x01,0x17,0xC0,0x0F,0x17,0x4C,0x21,0x14,0x41,0x01,  // 165
+  0x02,0x03,0x0F,0x00,0x80,0x1F,0x3F,  // 166
+  0x08,0x03,0x0F,0xC0,0x10,0x97,0x50,0x86,0x30,0x42,0x18,0x42,0x0C,0x61,0x1A,0xE9,0x00,0x03,  // 167
+  0x03,0x03,0x01,0x05,  // 168
+  0x0C,0x03,0x0C,0xF8,0x41,0x20,0x02,0x94,0x8F,0x05,0x59,0x90,0x05,0x59,0x90,0x89,0x28,0x40,0x04,0x82,0x1F,  // 169
+  0x05,0x03,0x06,0x5A,0x5A,0x96,0x3E,  // 170
+  0x07,0x07,0x07,0x00,0x84,0x2D,0x88,0xB0,0x05,0x01,  // 171
+  0x08,0x07,0x05,0x20,0x84,0x10,0x42,0xF8,  // 172
+  0x04,0x0B,0x01,0x0F,  // 173
+  0x0C,0x03,0x0C,0xF8,0x41,0x20,0x02,0xD4,0x9F,0x25,0x58,0x82,0x65,0x58,0x8A,0x19,0x29,0x40,0x04,0x82,0x1F,  // 174
+  0x09,0x02,0x01,0xFF,0x01,  // 175
+  0x05,0x03,0x04,0x60,0x99,0x06,  // 176
+  0x08,0x05,0x0A,0x00,0x20,0x88,0x20,0x82,0x7F,0x22,0x88,0x20,0x82,  // 177
+  0x05,0x03,0x06,0x62,0x9C,0xA6,0x26,  // 178
+  0x05,0x03,0x06,0x52,0x18,0x96,0x1B,  // 179
+  0x04,0x03,0x02,0x60,  // 180
+  0x08,0x06,0x0C,0x00,0xF0,0xFF,0x80,0x00,0x10,0x00,0x01,0x10,0x80,0xF0,0x1F,  // 181
+  0x09,0x03,0x0F,0x1E,0x80,0x0F,0xC0,0x0F,0xE0,0x07,0xF0,0xFF,0x0F,0x00,0x04,0x00,0xFE,0xFF,0x01,0x00,  // 182
+  0x03,0x09,0x01,0x04,  // 183
+  0x04,0x0F,0x03,0x60,0x0D,  // 184
+  0x04,0x03,0x06,0x80,0x10,0xFC,  // 185
+  0x05,0x03,0x06,0x5E,0x18,0x86,0x1E,  // 186
+  0x08,0x07,0x07,0x00,0x40,0xD0,0x86,0x08,0xDA,0x10,  // 187
+  0x0D,0x03,0x0C,0x00,0x20,0x00,0x01,0xF8,0x43,0x00,0x02,0x18,0x40,0x00,0x03,0x08,0x66,0x50,0x81,0x04,0xFC,0x00,0x04,  // 188
+  0x0D,0x03,0x0C,0x00,0x20,0x00,0x01,0xF8,0x63,0x00,0x01,0x08,0x60,0x00,0x01,0x8C,0x28,0xC4,0x41,0x0A,0xA4,0x80,0x09,  // 189
+  0x0D,0x03,0x0C,0x12,0x10,0x02,0x21,0x58,0x42,0x1B,0x03,0x08,0x60,0x00,0x01,0x08,0x66,0x50,0x81,0x04,0xFC,0x00,0x04,  // 190
+  0x09,0x06,0x0C,0x00,0x00,0x38,0x40,0x04,0x82,0x1D,0x08,0x80,0x00,0x08,0x40,0x00,0x03,  // 191
+  0x0A,0x00,0x0F,0x00,0x00,0x00,0x30,0x00,0x07,0xF0,0x10,0x47,0x50,0x20,0xC0,0x11,0x00,0x0F,0x00,0x1C,0x00,0x30,  // 192
+  0x0A,0x00,0x0F,0x00,0x00,0x00,0x30,0x00,0x07,0xF0,0x00,0x47,0x50,0x20,0xC4,0x11,0x00,0x0F,0x00,0x1C,0x00,0x30,  // 193
+  0x0A,0x00,0x0F,0x00,0x00,0x00,0x30,0x00,0x07,0xF0,0x20,0x47,0x48,0x20,0xC4,0x11,0x04,0x0F,0x00,0x1C,0x00,0x30,  // 194
+  0x0A,0x00,0x0F,0x00,0x00,0x00,0x30,0x00,0x07,0xF0,0x20,0x47,0x48,0x20,0xC8,0x11,0x02,0x0F,0x00,0x1C,0x00,0x30,  // 195
+  0x0A,0x01,0x0E,0x00,0x00,0x00,0x0C,0xE0,0x00,0x0F,0x39,0x02,0x81,0x90,0x23,0x00,0x0F,0x00,0x0E,0x00,0x0C,  // 196
+  0x0A,0x01,0x0E,0x00,0x00,0x00,0x0C,0xE0,0x00,0x0F,0x3F,0x42,0x81,0xF0,0x23,0x00,0x0F,0x00,0x0E,0x00,0x0C,  // 197
+  0x0F,0x03,0x0C,0x00,0x0C,0x30,0xC0,0x00,0x0B,0x8C,0x30,0x08,0x81,0x10,0x08,0xFF,0x1F,0x82,0x21,0x18,0x82,0x21,0x18,0x82,0x21,0x08,  // 198
+  0x0B,0x03,0x0F,0x00,0x00,0xFC,0x00,0x81,0x40,0x80,0x10,0x80,0x08,0x40,0x06,0x60,0x03,0xD0,0x01,0x08,0x01,0x02,0x81,0x00,  // 199
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x3F,0x42,0x10,0x21,0x88,0x10,0x4C,0x08,0x2A,0x04,0x11,0x82,0x08,0x41,0x04,0x20,  // 200
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x3F,0x42,0x10,0x21,0x88,0x10,0x54,0x08,0x26,0x04,0x11,0x82,0x08,0x41,0x04,0x20,  // 201
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x3F,0x42,0x10,0x21,0xA8,0x10,0x4C,0x08,0x26,0x04,0x15,0x82,0x08,0x41,0x04,0x20,  // 202
+  0x0A,0x01,0x0E,0x00,0x00,0xFF,0x4F,0x08,0x12,0x82,0x85,0x20,0x21,0x58,0x08,0x12,0x82,0x84,0x20,0x01,0x08,  // 203
+  0x02,0x00,0x0F,0x01,0x00,0xFD,0x3F,  // 204
+  0x03,0x00,0x0F,0x00,0x00,0xFD,0x7F,0x00,0x00,  // 205
+  0x04,0x00,0x0F,0x02,0x80,0xFC,0x7F,0x00,0x40,0x00,0x00,  // 206
+  0x03,0x01,0x0E,0x01,0x00,0xFF,0x1F,0x00,0x00,  // 207
+  0x0B,0x03,0x0C,0x40,0xF0,0xFF,0x41,0x18,0x84,0x41,0x18,0x84,0x01,0x18,0x80,0x02,0x44,0x20,0xF8,0x01,  // 208
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x3F,0x04,0x00,0x0C,0x20,0x08,0x08,0x18,0x08,0x10,0x02,0x30,0x00,0x20,0xFC,0x3F,  // 209
+  0x0B,0x00,0x0F,0x00,0x00,0xE0,0x07,0x08,0x04,0x02,0x84,0x00,0x4C,0x00,0x2A,0x00,0x11,0x80,0x10,0x20,0x10,0x08,0xF0,0x03,  // 210
+  0x0B,0x00,0x0F,0x00,0x00,0xE0,0x07,0x08,0x04,0x02,0x84,0x00,0x54,0x00,0x26,0x00,0x11,0x80,0x10,0x20,0x10,0x08,0xF0,0x03,  // 211
+  0x0B,0x00,0x0F,0x00,0x00,0xE0,0x07,0x08,0x04,0x02,0xA4,0x00,0x4C,0x00,0x26,0x00,0x15,0x80,0x10,0x20,0x10,0x08,0xF0,0x03,  // 212
+  0x0B,0x00,0x0F,0x00,0x00,0xE0,0x07,0x08,0x04,0x02,0xA4,0x00,0x4C,0x00,0x2A,0x00,0x13,0x80,0x10,0x20,0x10,0x08,0xF0,0x03,  // 213
+  0x0B,0x01,0x0E,0x00,0x00,0xF8,0x01,0x81,0x20,0x40,0x04,0x60,0x01,0x48,0x00,0x16,0x80,0x08,0x10,0x04,0x02,0x7E,0x00,  // 214
+  0x08,0x06,0x07,0x80,0xA0,0x88,0xC2,0xA1,0x88,0x82,  // 215
+  0x0B,0x03,0x0C,0x00,0x80,0x9F,0x04,0x26,0x60,0x81,0x19,0x84,0x21,0x98,0x81,0x06,0x64,0x20,0xF9,0x01,  // 216
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x0F,0x00,0x08,0x00,0x18,0x00,0x14,0x00,0x02,0x00,0x01,0x80,0x00,0x20,0xFC,0x0F,  // 217
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x0F,0x00,0x08,0x00,0x08,0x00,0x14,0x00,0x06,0x00,0x01,0x80,0x00,0x20,0xFC,0x0F,  // 218
+  0x0A,0x00,0x0F,0x00,0x00,0xFC,0x0F,0x00,0x08,0x00,0x28,0x00,0x0C,0x00,0x06,0x00,0x05,0x80,0x00,0x20,0xFC,0x0F,  // 219
+  0x0A,0x01,0x0E,0x00,0x00,0xFF,0x03,0x00,0x01,0x80,0x01,0x20,0x00,0x18,0x00,0x02,0x80,0x00,0x10,0xFF,0x03,  // 220
+  0x09,0x00,0x0F,0x08,0x00,0x18,0x00,0x10,0x00,0x30,0x20,0xE0,0x0F,0x0C,0x00,0x01,0x60,0x00,0x08,0x00,  // 221
+  0x0A,0x03,0x0C,0x00,0xF0,0xFF,0x04,0x42,0x20,0x04,0x42,0x20,0x04,0x42,0x20,0x08,0x01,0x0F,  // 222
+  0x08,0x03,0x0C,0x00,0xC0,0xFF,0x02,0x10,0x40,0x71,0xE8,0x84,0x80,0x08,0x70,  // 223
+  0x08,0x03,0x0C,0x00,0x00,0x72,0x90,0x88,0x88,0x89,0xA8,0x84,0x48,0x04,0xFF,  // 224
+  0x08,0x03,0x0C,0x00,0x00,0x72,0x90,0x88,0x88,0x8A,0x98,0x84,0x48,0x04,0xFF,  // 225
+  0x08,0x03,0x0C,0x00,0x00,0x72,0x90,0xA8,0x88,0x89,0x98,0x84,0x4A,0x04,0xFF,  // 226
+  0x08,0x03,0x0C,0x00,0x00,0x72,0x90,0xA8,0x88,0x89,0xA8,0x84,0x49,0x04,0xFF,  // 227
+  0x08,0x04,0x0B,0x00,0x80,0x1C,0x12,0x8B,0x48,0xC4,0x12,0x92,0x08,0xFF,  // 228
+  0x08,0x02,0x0D,0x00,0x00,0xC8,0x81,0xC4,0x8B,0x58,0x11,0x2F,0x21,0x24,0x02,0xFF,  // 229
+  0x0E,0x06,0x09,0x00,0xC8,0x49,0x8C,0x18,0x31,0x61,0x22,0x7F,0x92,0x22,0x46,0x8C,0x28,0x89,0x0B,  // 230
+  0x07,0x06,0x0C,0x00,0xC0,0x07,0x82,0x10,0x90,0x01,0x1B,0xD0,0x82,0x00,  // 231
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x90,0x94,0x88,0x8A,0x88,0x88,0x90,0x04,0x2E,  // 232
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x90,0x84,0x88,0x8A,0x98,0x88,0x90,0x04,0x2E,  // 233
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x90,0xA4,0x88,0x89,0x98,0x88,0x92,0x04,0x2E,  // 234
+  0x08,0x04,0x0B,0x00,0x80,0x0F,0x92,0x8A,0x48,0xC4,0x22,0x22,0x09,0x2E,  // 235
+  0x02,0x03,0x0C,0x01,0xA0,0xFF,  // 236
+  0x03,0x03,0x0C,0x00,0xA0,0xFF,0x01,0x00,  // 237
+  0x04,0x03,0x0C,0x02,0x90,0xFF,0x01,0x20,0x00,  // 238
+  0x03,0x04,0x0B,0x01,0xE0,0x7F,0x00,0x00,  // 239
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x14,0xD4,0x80,0x0B,0xE8,0x80,0x1D,0x04,0x3E,  // 240
+  0x07,0x03,0x0C,0x00,0x80,0xFF,0x12,0x90,0x00,0x0A,0x90,0x00,0xF0,0x0F,  // 241
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x10,0x94,0x80,0x0A,0x88,0x80,0x10,0x04,0x3E,  // 242
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x10,0x84,0x80,0x0A,0x98,0x80,0x10,0x04,0x3E,  // 243
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x10,0xA4,0x80,0x09,0x98,0x80,0x12,0x04,0x3E,  // 244
+  0x08,0x03,0x0C,0x00,0x00,0x3E,0x10,0xA4,0x80,0x09,0xA8,0x80,0x11,0x04,0x3E,  // 245
+  0x08,0x04,0x0B,0x00,0x80,0x0F,0x82,0x0A,0x48,0xC0,0x02,0x22,0x08,0x3E,  // 246
+  0x08,0x07,0x05,0x80,0x10,0x52,0x09,0x21,  // 247
+  0x08,0x06,0x09,0x00,0xF8,0x0A,0x0B,0x19,0x31,0xA1,0xA1,0x3E,  // 248
+  0x07,0x03,0x0C,0x00,0x80,0x7F,0x00,0x18,0x80,0x02,0x08,0x40,0xF8,0x0F,  // 249
+  0x07,0x03,0x0C,0x00,0x80,0x7F,0x00,0x08,0x80,0x02,0x18,0x40,0xF8,0x0F,  // 250
+  0x07,0x03,0x0C,0x00,0x80,0x7F,0x02,0x18,0x80,0x01,0x28,0x40,0xF8,0x0F,  // 251
+  0x07,0x04,0x0B,0x00,0xE8,0x1F,0x00,0x03,0x08,0x40,0x00,0xF1,0x1F,  // 252
+  0x07,0x03,0x0F,0x38,0x00,0x60,0x20,0xC0,0x51,0x80,0x17,0x70,0x00,0x07,0x60,0x00,0x00,  // 253
+  0x08,0x03,0x0F,0x00,0x80,0xFF,0x3F,0x04,0x01,0x01,0x81,0x80,0x40,0x40,0x40,0x10,0xC0,0x07,  // 254
+  0x07,0x04,0x0E,0x1C,0x00,0x18,0x18,0x38,0x02,0x78,0x81,0x03,0x1C,0xC0,0x00,0x00,  // 255
+};
+
+// ArialMT_Plain_24: 6154 bytes instead of 9643
+const uint8_t ArialMT_Plain_24_Packed[] PROGMEM = {
+  0x00, // Extended header
+  0x1C, // Height: 28
+  0x20, // First Char: 32
+  0xE0, // Numbers of Chars: 224
+  0x01, // Flags: bit packed
+  0x18, // Width: 24
+
+  // Jump Table:
+  0xFF, 0xFF, 0x00, 0x07,  // 32:65535
+  0x00, 0x00, 0x0E, 0x07,  // 33:0
+  0x00, 0x0E, 0x09, 0x09,  // 34:14
+  0x00, 0x17, 0x1F, 0x0D,  // 35:23
+  0x00, 0x36, 0x21, 0x0D,  // 36:54
+  0x00, 0x57, 0x2E, 0x15,  // 37:87
+  0x00, 0x85, 0x23, 0x10,  // 38:133
+  0x00, 0xA8, 0x06, 0x05,  // 39:168
+  0x00, 0xAE, 0x17, 0x08,  // 40:174
+  0x00, 0xC5, 0x17, 0x08,  // 41:197
+  0x00, 0xDC, 0x0B, 0x09,  // 42:220
+  0x00, 0xE7, 0x17, 0x0E,  // 43:231
+  0x00, 0xFE, 0x06, 0x07,  // 44:254
+  0x01, 0x04, 0x05, 0x08,  // 45:260
+  0x01, 0x09, 0x04, 0x07,  // 46:265
+  0x01, 0x0D, 0x12, 0x07,  // 47:269
+  0x01, 0x1F, 0x1D, 0x0D,  // 48:287
+  0x01, 0x3C, 0x17, 0x0D,  // 49:316
+  0x01, 0x53, 0x1D, 0x0D,  // 50:339
+  0x01, 0x70, 0x1D, 0x0D,  // 51:368
+  0x01, 0x8D, 0x1D, 0x0D,  // 52:397
+  0x01, 0xAA, 0x1D, 0x0D,  // 53:426
+  0x01, 0xC7, 0x1D, 0x0D,  // 54:455
+  0x01, 0xE4, 0x1D, 0x0D,  // 55:484
+  0x02, 0x01, 0x1D, 0x0D,  // 56:513
+  0x02, 0x1E, 0x1D, 0x0D,  // 57:542
+  0x02, 0x3B, 0x0A, 0x07,  // 58:571
+  0x02, 0x45, 0x0C, 0x07,  // 59:581
+  0x02, 0x51, 0x14, 0x0E,  // 60:593
+  0x02, 0x65, 0x0E, 0x0E,  // 61:613
+  0x02, 0x73, 0x14, 0x0E,  // 62:627
+  0x02, 0x87, 0x1D, 0x0D,  // 63:647
+  0x02, 0xA4, 0x43, 0x18,  // 64:676
+  0x02, 0xE7, 0x23, 0x10,  // 65:743
+  0x03, 0x0A, 0x23, 0x10,  // 66:778
+  0x03, 0x2D, 0x25, 0x11,  // 67:813
+  0x03, 0x52, 0x25, 0x11,  // 68:850
+  0x03, 0x77, 0x23, 0x10,  // 69:887
+  0x03, 0x9A, 0x21, 0x0F,  // 70:922
+  0x03, 0xBB, 0x28, 0x13,  // 71:955
+  0x03, 0xE3, 0x23, 0x11,  // 72:995
+  0x04, 0x06, 0x0C, 0x07,  // 73:1030
+  0x04, 0x12, 0x19, 0x0C,  // 74:1042
+  0x04, 0x2B, 0x25, 0x10,  // 75:1067
+  0x04, 0x50, 0x1D, 0x0D,  // 76:1104
+  0x04, 0x6D, 0x28, 0x14,  // 77:1133
+  0x04, 0x95, 0x23, 0x11,  // 78:1173
+  0x04, 0xB8, 0x2A, 0x13,  // 79:1208
+  0x04, 0xE2, 0x23, 0x10,  // 80:1250
+  0x05, 0x05, 0x2C, 0x13,  // 81:1285
+  0x05, 0x31, 0x25, 0x11,  // 82:1329
+  0x05, 0x56, 0x23, 0x10,  // 83:1366
+  0x05, 0x79, 0x21, 0x0F,  // 84:1401
+  0x05, 0x9A, 0x23, 0x11,  // 85:1434
+  0x05, 0xBD, 0x23, 0x10,  // 86:1469
+  0x05, 0xE0, 0x34, 0x17,  // 87:1504
+  0x06, 0x14, 0x23, 0x10,  // 88:1556
+  0x06, 0x37, 0x25, 0x10,  // 89:1591
+  0x06, 0x5C, 0x21, 0x0F,  // 90:1628
+  0x06, 0x7D, 0x11, 0x07,  // 91:1661
+  0x06, 0x8E, 0x12, 0x07,  // 92:1678
+  0x06, 0xA0, 0x14, 0x07,  // 93:1696
+  0x06, 0xB4, 0x10, 0x0B,  // 94:1716
+  0x06, 0xC4, 0x07, 0x0D,  // 95:1732
+  0x06, 0xCB, 0x05, 0x08,  // 96:1739
+  0x06, 0xD0, 0x17, 0x0D,  // 97:1744
+  0x06, 0xE7, 0x1F, 0x0D,  // 98:1767
+  0x07, 0x06, 0x15, 0x0C,  // 99:1798
+  0x07, 0x1B, 0x1D, 0x0D,  // 100:1819
+  0x07, 0x38, 0x17, 0x0D,  // 101:1848
+  0x07, 0x4F, 0x12, 0x07,  // 102:1871
+  0x07, 0x61, 0x1E, 0x0D,  // 103:1889
+  0x07, 0x7F, 0x1D, 0x0D,  // 104:1919
+  0x07, 0x9C, 0x0C, 0x05,  // 105:1948
+  0x07, 0xA8, 0x0E, 0x05,  // 106:1960
+  0x07, 0xB6, 0x1D, 0x0C,  // 107:1974
+  0x07, 0xD3, 0x0C, 0x05,  // 108:2003
+  0x07, 0xDF, 0x21, 0x14,  // 109:2015
+  0x08, 0x00, 0x17, 0x0D,  // 110:2048
+  0x08, 0x17, 0x17, 0x0D,  // 111:2071
+  0x08, 0x2E, 0x21, 0x0D,  // 112:2094
+  0x08, 0x4F, 0x1E, 0x0D,  // 113:2127
+  0x08, 0x6D, 0x10, 0x08,  // 114:2157
+  0x08, 0x7D, 0x15, 0x0C,  // 115:2173
+  0x08, 0x92, 0x12, 0x07,  // 116:2194
+  0x08, 0xA4, 0x17, 0x0D,  // 117:2212
+  0x08, 0xBB, 0x15, 0x0C,  // 118:2235
+  0x08, 0xD0, 0x1F, 0x11,  // 119:2256
+  0x08, 0xEF, 0x15, 0x0C,  // 120:2287
+  0x09, 0x04, 0x1C, 0x0C,  // 121:2308
+  0x09, 0x20, 0x15, 0x0C,  // 122:2336
+  0x09, 0x35, 0x17, 0x08,  // 123:2357
+  0x09, 0x4C, 0x0F, 0x06,  // 124:2380
+  0x09, 0x5B, 0x17, 0x08,  // 125:2395
+  0x09, 0x72, 0x0A, 0x0E,  // 126:2418
+  0xFF, 0xFF, 0x00, 0x00,  // 127:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 128:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 129:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 130:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 131:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 132:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 133:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 134:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 135:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 136:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 137:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 138:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 139:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 140:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 141:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 142:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 143:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 144:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 145:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 146:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 147:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 148:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 149:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 150:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 151:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 152:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 153:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 154:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 155:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 156:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 157:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 158:65535
+  0xFF, 0xFF, 0x00, 0x18,  // 159:65535
+  0xFF, 0xFF, 0x00, 0x07,  // 160:65535
+  0x09, 0x7C, 0x0F, 0x08,  // 161:2428
+  0x09, 0x8B, 0x22, 0x0D,  // 162:2443
+  0x09, 0xAD, 0x1D, 0x0D,  // 163:2477
+  0x09, 0xCA, 0x17, 0x0D,  // 164:2506
+  0x09, 0xE1, 0x1F, 0x0D,  // 165:2529
+  0x0A, 0x00, 0x0F, 0x06,  // 166:2560
+  0x0A, 0x0F, 0x24, 0x0D,  // 167:2575
+  0x0A, 0x33, 0x05, 0x08,  // 168:2611
+  0x0A, 0x38, 0x2A, 0x12,  // 169:2616
+  0x0A, 0x62, 0x0B, 0x09,  // 170:2658
+  0x0A, 0x6D, 0x11, 0x0D,  // 171:2669
+  0x0A, 0x7E, 0x0E, 0x0E,  // 172:2686
+  0x0A, 0x8C, 0x05, 0x08,  // 173:2700
+  0x0A, 0x91, 0x2A, 0x12,  // 174:2705
+  0x0A, 0xBB, 0x07, 0x0D,  // 175:2747
+  0x0A, 0xC2, 0x0A, 0x0A,  // 176:2754
+  0x0A, 0xCC, 0x1A, 0x0D,  // 177:2764
+  0x0A, 0xE6, 0x0B, 0x08,  // 178:2790
+  0x0A, 0xF1, 0x0B, 0x08,  // 179:2801
+  0x0A, 0xFC, 0x06, 0x08,  // 180:2812
+  0x0B, 0x02, 0x1E, 0x0E,  // 181:2818
+  0x0B, 0x20, 0x27, 0x0D,  // 182:2848
+  0x0B, 0x47, 0x05, 0x08,  // 183:2887
+  0x0B, 0x4C, 0x06, 0x08,  // 184:2892
+  0x0B, 0x52, 0x0A, 0x08,  // 185:2898
+  0x0B, 0x5C, 0x0C, 0x09,  // 186:2908
+  0x0B, 0x68, 0x14, 0x0D,  // 187:2920
+  0x0B, 0x7C, 0x2E, 0x14,  // 188:2940
+  0x0B, 0xAA, 0x2C, 0x14,  // 189:2986
+  0x0B, 0xD6, 0x2C, 0x14,  // 190:3030
+  0x0C, 0x02, 0x21, 0x0F,  // 191:3074
+  0x0C, 0x23, 0x2B, 0x10,  // 192:3107
+  0x0C, 0x4E, 0x2B, 0x10,  // 193:3150
+  0x0C, 0x79, 0x2B, 0x10,  // 194:3193
+  0x0C, 0xA4, 0x2B, 0x10,  // 195:3236
+  0x0C, 0xCF, 0x29, 0x10,  // 196:3279
+  0x0C, 0xF8, 0x2B, 0x10,  // 197:3320
+  0x0D, 0x23, 0x34, 0x18,  // 198:3363
+  0x0D, 0x57, 0x2D, 0x11,  // 199:3415
+  0x0D, 0x84, 0x2B, 0x10,  // 200:3460
+  0x0D, 0xAF, 0x2B, 0x10,  // 201:3503
+  0x0D, 0xDA, 0x2B, 0x10,  // 202:3546
+  0x0E, 0x05, 0x29, 0x10,  // 203:3589
+  0x0E, 0x2E, 0x11, 0x07,  // 204:3630
+  0x0E, 0x3F, 0x11, 0x07,  // 205:3647
+  0x0E, 0x50, 0x13, 0x07,  // 206:3664
+  0x0E, 0x63, 0x12, 0x07,  // 207:3683
+  0x0E, 0x75, 0x25, 0x11,  // 208:3701
+  0x0E, 0x9A, 0x2B, 0x11,  // 209:3738
+  0x0E, 0xC5, 0x33, 0x13,  // 210:3781
+  0x0E, 0xF8, 0x33, 0x13,  // 211:3832
+  0x0F, 0x2B, 0x33, 0x13,  // 212:3883
+  0x0F, 0x5E, 0x33, 0x13,  // 213:3934
+  0x0F, 0x91, 0x30, 0x13,  // 214:3985
+  0x0F, 0xC1, 0x10, 0x0E,  // 215:4033
+  0x0F, 0xD1, 0x2E, 0x13,  // 216:4049
+  0x0F, 0xFF, 0x2B, 0x11,  // 217:4095
+  0x10, 0x2A, 0x2B, 0x11,  // 218:4138
+  0x10, 0x55, 0x2B, 0x11,  // 219:4181
+  0x10, 0x80, 0x29, 0x11,  // 220:4224
+  0x10, 0xA9, 0x2D, 0x10,  // 221:4265
+  0x10, 0xD6, 0x23, 0x10,  // 222:4310
+  0x10, 0xF9, 0x21, 0x0F,  // 223:4345
+  0x11, 0x1A, 0x1D, 0x0D,  // 224:4378
+  0x11, 0x37, 0x1D, 0x0D,  // 225:4407
+  0x11, 0x54, 0x1D, 0x0D,  // 226:4436
+  0x11, 0x71, 0x1D, 0x0D,  // 227:4465
+  0x11, 0x8E, 0x1B, 0x0D,  // 228:4494
+  0x11, 0xA9, 0x20, 0x0D,  // 229:4521
+  0x11, 0xC9, 0x26, 0x15,  // 230:4553
+  0x11, 0xEF, 0x1B, 0x0C,  // 231:4591
+  0x12, 0x0A, 0x1D, 0x0D,  // 232:4618
+  0x12, 0x27, 0x1D, 0x0D,  // 233:4647
+  0x12, 0x44, 0x1D, 0x0D,  // 234:4676
+  0x12, 0x61, 0x1B, 0x0D,  // 235:4705
+  0x12, 0x7C, 0x0E, 0x07,  // 236:4732
+  0x12, 0x8A, 0x0E, 0x07,  // 237:4746
+  0x12, 0x98, 0x10, 0x07,  // 238:4760
+  0x12, 0xA8, 0x0F, 0x07,  // 239:4776
+  0x12, 0xB7, 0x1D, 0x0D,  // 240:4791
+  0x12, 0xD4, 0x1D, 0x0D,  // 241:4820
+  0x12, 0xF1, 0x1D, 0x0D,  // 242:4849
+  0x13, 0x0E, 0x1D, 0x0D,  // 243:4878
+  0x13, 0x2B, 0x1D, 0x0D,  // 244:4907
+  0x13, 0x48, 0x1D, 0x0D,  // 245:4936
+  0x13, 0x65, 0x1B, 0x0D,  // 246:4965
+  0x13, 0x80, 0x10, 0x0D,  // 247:4992
+  0x13, 0x90, 0x1C, 0x0F,  // 248:5008
+  0x13, 0xAC, 0x1D, 0x0D,  // 249:5036
+  0x13, 0xC9, 0x1D, 0x0D,  // 250:5065
+  0x13, 0xE6, 0x1D, 0x0D,  // 251:5094
+  0x14, 0x03, 0x1B, 0x0D,  // 252:5123
+  0x14, 0x1E, 0x22, 0x0C,  // 253:5150
+  0x14, 0x40, 0x24, 0x0D,  // 254:5184
+  0x14, 0x64, 0x20, 0x0C,  // 255:5220
+  // Font Data:
+  0x05,0x05,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0xFC,0xFF,0x19,  // 33
+  0x07,0x05,0x06,0xC0,0xFF,0x03,0xC0,0xFF,0x03,  // 34
+  0x0D,0x05,0x11,0x60,0x18,0xC0,0x30,0x83,0xE1,0x07,0xFF,0xC3,0xFF,0xE1,0x0F,0xC3,0x18,0x66,0x30,0xFC,0xE0,0x7F,0xF8,0x3F,0xFC,0x61,0x18,0xC3,0x00,0x86,0x01,  // 35
+  0x0C,0x04,0x14,0x00,0x00,0x80,0x07,0x06,0xFC,0xE0,0xC1,0x18,0x1C,0x86,0x81,0x63,0x30,0x30,0xFF,0xFF,0x6F,0x30,0x30,0x06,0x86,0xC3,0x60,0x18,0x1C,0xFC,0x01,0x81,0x07,  // 36
+  0x14,0x05,0x11,0x00,0x00,0xF8,0x00,0xF8,0x03,0x18,0x0C,0x10,0x10,0x20,0x20,0xE0,0x60,0x70,0x7F,0x78,0x7C,0x7C,0x00,0x3C,0x00,0x1E,0x00,0x0F,0x80,0xC7,0xC7,0xC3,0xDF,0xC1,0xE0,0x80,0x80,0x00,0x01,0x01,0x06,0x03,0xF8,0x03,0xE0,0x03,  // 37
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x78,0x00,0xF8,0xE1,0x38,0xE7,0x3B,0xFC,0x3C,0xF0,0x70,0xE0,0xE1,0xC1,0x67,0xC7,0xFD,0xB8,0x71,0xE0,0x03,0xC0,0x03,0xE0,0x0F,0xC0,0x38,0x00,0x20,  // 38
+  0x03,0x05,0x06,0xC0,0xFF,0x03,  // 39
+  0x07,0x05,0x16,0x00,0x00,0x00,0xE0,0x1F,0x00,0xFF,0x3F,0xF0,0x01,0x3E,0x0E,0x00,0xDC,0x00,0x00,0x1C,0x00,0x00,0x02,  // 40
+  0x07,0x05,0x16,0x00,0x00,0x40,0x00,0x00,0x38,0x00,0x00,0x3B,0x00,0x70,0x7C,0x80,0x0F,0xFC,0xFF,0x00,0xF8,0x07,0x00,  // 41
+  0x09,0x05,0x07,0x00,0x02,0x89,0xFF,0xF9,0xF0,0x49,0x04,  // 42
+  0x0D,0x08,0x0C,0x00,0x00,0x06,0x60,0x00,0x06,0x60,0x00,0x06,0xFF,0xFF,0xFF,0x60,0x00,0x06,0x60,0x00,0x06,0x60,0x00,  // 43
+  0x04,0x14,0x06,0x00,0x30,0x7F,  // 44
+  0x07,0x0F,0x02,0xFF,0x3F,  // 45
+  0x04,0x14,0x02,0xF0,  // 46
+  0x07,0x05,0x11,0x00,0x80,0x01,0xE0,0x03,0xFC,0x01,0x7F,0xC0,0x1F,0xE0,0x03,0xC0,0x00,0x00,  // 47
+  0x0C,0x05,0x11,0x00,0x00,0xE0,0x3F,0xF0,0xFF,0x71,0x00,0x77,0x00,0x7C,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x07,0xC0,0x1D,0xC0,0xF1,0xFF,0x81,0xFF,0x00,  // 48
+  0x09,0x05,0x11,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x01,0x80,0x03,0x00,0x03,0x00,0x03,0x80,0xFF,0xFF,0xFF,0xFF,0x01,  // 49
+  0x0C,0x05,0x11,0x00,0x00,0x30,0x00,0x7B,0x00,0x37,0x00,0x3F,0x00,0x7B,0x00,0xF3,0x00,0xE3,0x01,0xC3,0x03,0x83,0x0D,0x03,0xFB,0x03,0xC6,0x03,0x0C,  // 50
+  0x0C,0x05,0x11,0x00,0x00,0x10,0x60,0x38,0xC0,0x31,0x00,0x37,0x00,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0xC6,0x81,0xFD,0x86,0xF1,0xF8,0x01,0xE0,0x01,  // 51
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x38,0x00,0x78,0x00,0xFC,0x00,0x9E,0x01,0x0E,0x03,0x0F,0x06,0x07,0x0C,0xFF,0xFF,0xFF,0xFF,0x03,0x60,0x00,0xC0,0x00,  // 52
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x63,0xF0,0xC7,0xF9,0x07,0x36,0x04,0x78,0x0C,0xF0,0x18,0xE0,0x31,0xC0,0x63,0x80,0x87,0xC1,0x0D,0xFE,0x01,0xF8,0x00,  // 53
+  0x0C,0x05,0x11,0x00,0x00,0xC0,0x3F,0xF0,0xFF,0xF1,0x18,0x67,0x18,0x7C,0x18,0xF0,0x30,0xE0,0x61,0xC0,0xC3,0x80,0x0F,0x83,0x39,0xFE,0x61,0xF0,0x01,  // 54
+  0x0C,0x05,0x11,0x00,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x7E,0x80,0xFF,0xC0,0x87,0xE1,0x01,0x73,0x00,0x36,0x00,0x3C,0x00,0x18,0x00,0x00,  // 55
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x78,0xF0,0xF8,0xF3,0x1B,0x76,0x1C,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0xC7,0x81,0xFD,0x86,0xF1,0xF8,0x03,0xE0,0x01,  // 56
+  0x0C,0x05,0x11,0x00,0x00,0xF0,0xC1,0xF0,0x8F,0x73,0x18,0x3E,0x60,0x78,0xC0,0xF0,0x80,0xE1,0x01,0xC3,0x03,0xC3,0x1C,0xE3,0xF1,0xFF,0x81,0x7F,0x00,  // 57
+  0x04,0x09,0x0D,0x00,0x00,0x00,0x0C,0xE0,0x01,0x0C,  // 58
+  0x04,0x09,0x11,0x00,0x00,0x00,0x00,0x0C,0x60,0x1E,0xC0,0x07,  // 59
+  0x0C,0x08,0x0B,0x00,0x00,0x01,0x1C,0xA0,0x80,0x0D,0x6C,0x30,0x86,0x31,0x04,0x31,0x98,0xC1,0x06,0x0C,  // 60
+  0x0C,0x0A,0x07,0x80,0xF1,0x78,0x3C,0x1E,0x8F,0xC7,0xE3,0xF1,0x78,0x0C,  // 61
+  0x0C,0x08,0x0B,0x00,0x18,0xB0,0xC1,0x0C,0x46,0x10,0xC6,0x30,0x06,0x1B,0xD8,0x80,0x02,0x1C,0x40,0x00,  // 62
+  0x0C,0x05,0x11,0x00,0x00,0x30,0x00,0x70,0x00,0x70,0x00,0x70,0x00,0x60,0x80,0xF3,0x80,0xE7,0x81,0x03,0x83,0x01,0x8C,0x03,0xF8,0x03,0xC0,0x01,0x00,  // 63
+  0x17,0x05,0x16,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFC,0x1F,0xC0,0x03,0x1E,0x38,0x00,0x0E,0x87,0x0F,0xE3,0xF8,0xCF,0x19,0x07,0x63,0x66,0x80,0xD9,0x1C,0x60,0x3C,0x03,0x18,0xCF,0x00,0xC3,0x33,0x60,0xF0,0x18,0x3C,0x3C,0xFC,0x1F,0xDF,0x3F,0xC6,0x76,0x80,0xB1,0x03,0x30,0xC6,0x01,0x8E,0xE1,0xE0,0x31,0xF0,0x3F,0x0C,0xF0,0x83,0x01,0x00,0x20,0x00,  // 64
+  0x0F,0x05,0x11,0x00,0x80,0x01,0xE0,0x03,0xF0,0x01,0xFC,0x00,0xFF,0x80,0x8F,0xC1,0x07,0x83,0x01,0x06,0x1F,0x0C,0xF8,0x18,0xC0,0x3F,0x00,0xFC,0x00,0xC0,0x07,0x00,0x3E,0x00,0x60,  // 65
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x06,0x36,0x1E,0xEC,0x7F,0x8C,0xC7,0x1F,0x00,0x0F,  // 66
+  0x10,0x05,0x11,0x00,0x00,0xC0,0x1F,0xE0,0xFF,0xE0,0xC1,0xE3,0x00,0xCE,0x00,0xD8,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x1E,0x00,0x6C,0x00,0xCC,0x01,0x1C,0x07,0x1E,0x08,0x0C,  // 67
+  0x10,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x00,0x78,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x3E,0x00,0xE6,0x00,0x8E,0x03,0x0E,0xFE,0x0F,0xF0,0x07,  // 68
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x06,0x1E,0x0C,0x3C,0x18,0x78,0x30,0xF0,0x00,0x60,  // 69
+  0x0E,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x60,0x30,0xC0,0x60,0x80,0xC1,0x00,0x83,0x01,0x06,0x03,0x0C,0x06,0x18,0x0C,0x30,0x18,0x60,0x00,0x00,  // 70
+  0x11,0x05,0x11,0x00,0x00,0xC0,0x1F,0xE0,0xFF,0xE0,0xC1,0xE3,0x00,0xCE,0x00,0xD8,0x01,0xB0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x0C,0x1E,0x18,0x7C,0x30,0xDC,0x60,0x98,0xC3,0x30,0x8E,0x3F,0x10,0x7F,0x00,  // 71
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0xE0,0xFF,0xFF,0xFF,0x7F,  // 72
+  0x04,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,  // 73
+  0x0A,0x05,0x11,0x00,0x00,0x00,0xE0,0x00,0xC0,0x03,0x00,0x0E,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xE0,0xFF,0xFF,0xFE,0xFF,0x00,  // 74
+  0x10,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x70,0x00,0x70,0x00,0x70,0x00,0xF0,0x01,0xF0,0x07,0x70,0x1E,0x70,0xF0,0x70,0xC0,0x73,0x00,0x6F,0x00,0x78,0x00,0x60,0x00,0x80,  // 75
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0C,  // 76
+  0x11,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0xFF,0x00,0xC0,0x0F,0x00,0xFC,0x01,0x80,0x1F,0x00,0xF8,0x01,0x00,0x03,0xE0,0x07,0xF8,0x01,0x7F,0xC0,0x0F,0xC0,0x03,0x80,0xFF,0xFF,0xFF,0xFF,0x01,  // 77
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0xEF,0x00,0x80,0x03,0x00,0x1C,0x00,0xF0,0x00,0x80,0x03,0x00,0x1E,0x00,0x70,0x00,0xC0,0x03,0x00,0xEE,0xFF,0xFF,0xFF,0x7F,  // 78
+  0x12,0x05,0x11,0x00,0x00,0xC0,0x1F,0xE0,0xFF,0xE0,0xC1,0xE3,0x00,0xCE,0x00,0xD8,0x01,0xF0,0x01,0xC0,0x03,0x80,0x07,0x00,0x0F,0x00,0x1E,0x00,0x7C,0x00,0xDC,0x00,0x98,0x03,0x38,0x1E,0x3C,0xF8,0x3F,0xC0,0x1F,0x00,  // 79
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x30,0x60,0x60,0xC0,0xC0,0x80,0x81,0x01,0x03,0x03,0x06,0x06,0x0C,0x0C,0x18,0x18,0x60,0x18,0xC0,0x3F,0x00,0x1E,0x00,  // 80
+  0x12,0x05,0x12,0x00,0x00,0x80,0x3F,0x80,0xFF,0x03,0x0F,0x1E,0x0E,0x60,0x18,0x00,0x73,0x00,0xCC,0x00,0x60,0x03,0x80,0x0D,0x00,0x36,0x00,0xDB,0x00,0x6C,0x07,0xE0,0x19,0x80,0xE3,0x00,0x0E,0x0F,0x7E,0xF8,0xBF,0x83,0x3F,0x0C,  // 81
+  0x10,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x60,0x30,0xC0,0x60,0x80,0xC1,0x00,0x83,0x03,0x06,0x0F,0x0C,0x7E,0x18,0xEC,0x71,0x8C,0xCF,0x1F,0x3C,0x1F,0x60,0x00,0x80,  // 82
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x30,0xE0,0xE0,0xF1,0x07,0x67,0x0C,0x6C,0x38,0xF8,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x0E,0x36,0x18,0xE6,0x70,0x8C,0xC3,0x0F,0x06,0x0F,  // 83
+  0x0E,0x05,0x11,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0x03,0x00,0x06,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0x60,0x00,0x00,  // 84
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0x7F,0xF8,0xFF,0x03,0x00,0x0E,0x00,0x38,0x00,0x60,0x00,0xC0,0x00,0x80,0x01,0x00,0x03,0x00,0x06,0x00,0x0E,0x00,0xEE,0xFF,0xCF,0xFF,0x07,  // 85
+  0x0F,0x05,0x11,0x01,0x00,0x1E,0x00,0xF8,0x01,0x80,0x0F,0x00,0xFC,0x00,0xC0,0x0F,0x00,0x7C,0x00,0xE0,0x00,0xF0,0x01,0xFC,0x00,0x3F,0x80,0x0F,0xE0,0x07,0xE0,0x01,0x40,0x00,0x00,  // 86
+  0x17,0x05,0x11,0x03,0x00,0x7E,0x00,0xF0,0x1F,0x00,0xFE,0x03,0xC0,0x1F,0x00,0x30,0x00,0x7E,0x80,0x3F,0xE0,0x0F,0xF8,0x01,0x7C,0x00,0x18,0x00,0xF0,0x01,0x80,0x1F,0x00,0xF8,0x03,0x80,0x3F,0x00,0xF8,0x01,0x00,0x03,0xF0,0x07,0xFE,0xC3,0x7F,0xE0,0x07,0xC0,0x00,0x00,  // 87
+  0x0F,0x05,0x11,0x00,0x00,0x03,0x00,0x0F,0x80,0x7F,0x80,0xE7,0xC1,0x03,0xCF,0x03,0xFC,0x03,0xE0,0x00,0xF0,0x0F,0xF0,0x3C,0x78,0xE0,0x78,0x80,0x37,0x00,0x3E,0x00,0x30,0x00,0x40,  // 88
+  0x10,0x05,0x11,0x01,0x00,0x06,0x00,0x38,0x00,0xE0,0x00,0x80,0x03,0x00,0x1E,0x00,0x78,0x00,0xC0,0xFF,0x80,0xFF,0xC1,0x03,0xC0,0x03,0xC0,0x01,0xE0,0x01,0xE0,0x01,0xC0,0x00,0x80,0x00,0x00,  // 89
+  0x0E,0x05,0x11,0x00,0x80,0x07,0x80,0x0F,0x80,0x1F,0xC0,0x3D,0xC0,0x79,0xC0,0xF1,0xC0,0xE1,0xE1,0xC0,0xE3,0x80,0xE7,0x00,0xEF,0x00,0x7E,0x00,0x7C,0x00,0x78,0x00,0x30,  // 90
+  0x05,0x05,0x16,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0xC0,0x03,0x00,0x30,  // 91
+  0x07,0x05,0x11,0x03,0x00,0x3E,0x00,0xF0,0x07,0x00,0x7F,0x00,0xF0,0x07,0x00,0x3E,0x00,0x60,  // 92
+  0x06,0x05,0x16,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x0F,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,  // 93
+  0x0B,0x05,0x09,0x00,0x00,0x02,0xC7,0xE7,0xE3,0xC0,0x01,0x1F,0xF8,0x80,0x03,0x04,  // 94
+  0x0D,0x19,0x02,0xFF,0xFF,0xFF,0x03,  // 95
+  0x05,0x05,0x03,0xC8,0x4E,  // 96
+  0x0C,0x09,0x0D,0x00,0x80,0xE1,0x38,0x3E,0x63,0x3E,0x8C,0x87,0xF1,0x18,0x1E,0x63,0x67,0xC6,0xFF,0xF1,0x7F,0x00,0x08,  // 97
+  0x0D,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x0C,0x06,0x0C,0x18,0x0C,0x60,0x18,0xC0,0x30,0x80,0xE1,0x80,0x83,0x83,0x03,0xFE,0x03,0xF0,0x01,  // 98
+  0x0B,0x09,0x0D,0x00,0x00,0x7F,0xF0,0x1F,0x07,0x77,0xC0,0x07,0xF0,0x00,0x1E,0xC0,0x07,0xDC,0xC1,0x31,0x18,  // 99
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x3E,0x00,0xFF,0x01,0x07,0x07,0x07,0x1C,0x06,0x30,0x0C,0x60,0x18,0xC0,0x60,0xC0,0x80,0xC1,0xFC,0xFF,0xFF,0xFF,0x0F,  // 100
+  0x0C,0x09,0x0D,0x00,0x00,0x7E,0xF0,0x1F,0x37,0x77,0xC6,0xC7,0xF0,0x18,0x1E,0xC3,0x67,0xDC,0x8D,0xF1,0x19,0x3C,0x01,  // 101
+  0x07,0x05,0x11,0x30,0x00,0x60,0x00,0xF8,0xFF,0xFF,0xFF,0x3F,0x03,0x60,0x06,0xC0,0x0C,0x00,  // 102
+  0x0C,0x09,0x12,0x00,0x00,0xC0,0x07,0xC3,0x7F,0x9C,0x83,0xE3,0x07,0x1C,0x0F,0x60,0x3C,0x80,0xF1,0x00,0xC6,0x06,0x8C,0x33,0x18,0xF7,0xFF,0xCF,0xFF,0x1F,  // 103
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x0C,0x00,0x0C,0x00,0x0C,0x00,0x18,0x00,0x30,0x00,0xE0,0x00,0x80,0xFF,0x07,0xFE,0x0F,  // 104
+  0x04,0x05,0x11,0x00,0x00,0x00,0x00,0xCC,0xFF,0x9F,0xFF,0x0F,  // 105
+  0x04,0x05,0x16,0x00,0x00,0x30,0x00,0x00,0x3C,0xFF,0xFF,0xCF,0xFF,0x7F,  // 106
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,0x60,0x00,0xE0,0x00,0xE0,0x03,0x60,0x1E,0x60,0x70,0x60,0xC0,0x43,0x00,0x06,0x00,0x08,  // 107
+  0x04,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x0F,  // 108
+  0x12,0x09,0x0D,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x6F,0x00,0x04,0xC0,0x00,0x18,0x00,0x07,0xC0,0xFF,0xF3,0x7F,0x03,0x20,0x00,0x06,0xC0,0x00,0x38,0x00,0xFE,0x9F,0xFF,0x03,  // 109
+  0x0C,0x09,0x0D,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xCF,0x00,0x0C,0xC0,0x00,0x18,0x00,0x03,0xE0,0x00,0xF8,0x7F,0xFE,0x0F,  // 110
+  0x0C,0x09,0x0D,0x00,0x00,0x7F,0xF0,0x1F,0x07,0x77,0xC0,0x07,0xF0,0x00,0x1E,0xC0,0x07,0xDC,0xC1,0xF1,0x1F,0xFC,0x01,  // 111
+  0x0D,0x09,0x12,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0xFF,0x0C,0x06,0x18,0x30,0x30,0x80,0xC1,0x00,0x06,0x03,0x18,0x1C,0x70,0xE0,0xE0,0x00,0xFF,0x01,0xF0,0x01,0x00,  // 112
+  0x0C,0x09,0x12,0x00,0x00,0xC0,0x07,0xC0,0x7F,0x80,0x83,0x03,0x07,0x1C,0x0C,0x60,0x30,0x80,0xC1,0x00,0x06,0x06,0x0C,0x30,0x18,0xF0,0xFF,0xFF,0xFF,0xFF,  // 113
+  0x08,0x09,0x0D,0x00,0x00,0x00,0xFC,0xFF,0xFF,0x6F,0x00,0x06,0xC0,0x00,0x18,0x00,  // 114
+  0x0B,0x09,0x0D,0x00,0x80,0xC3,0xF8,0xB8,0x3B,0x3E,0x86,0xC7,0xF0,0x38,0x1E,0xC7,0xC7,0xDC,0xF9,0x31,0x1E,  // 115
+  0x07,0x05,0x11,0x30,0x00,0x60,0x00,0xF8,0xFF,0xFB,0xFF,0x0F,0x03,0x18,0x06,0x30,0x0C,0x60,  // 116
+  0x0C,0x09,0x0D,0x00,0x00,0x00,0xFC,0x9F,0xFF,0x07,0xC0,0x01,0x30,0x00,0x06,0xC0,0x00,0x0C,0xC0,0xFC,0xFF,0xFF,0x0F,  // 117
+  0x0B,0x09,0x0D,0x03,0xE0,0x03,0xF0,0x01,0xF0,0x01,0xF8,0x00,0x38,0xE0,0x03,0x1F,0x7C,0xE0,0x03,0x0C,0x00,  // 118
+  0x11,0x09,0x0D,0x07,0xE0,0x07,0xE0,0x07,0xE0,0x07,0xC0,0x81,0x1F,0x7C,0xF0,0x01,0x07,0xC0,0x07,0xC0,0x07,0xE0,0x07,0xC0,0x81,0x1F,0x7E,0xF8,0x01,0x07,0x00,  // 119
+  0x0B,0x09,0x0D,0x01,0x70,0x00,0x3F,0x78,0x8E,0x83,0x3F,0xC0,0x01,0xFC,0xE0,0x38,0x0E,0xFE,0x00,0x07,0x40,  // 120
+  0x0B,0x09,0x12,0x00,0x00,0x1C,0x00,0xF0,0x03,0x30,0x3E,0xC0,0xC0,0x87,0x03,0xFC,0x07,0xE0,0x07,0xF8,0x03,0xFC,0x01,0x7C,0x00,0x30,0x00,0x00,  // 121
+  0x0B,0x09,0x0D,0x00,0x00,0x00,0x0F,0xF8,0x81,0x3F,0xB8,0xC7,0xF3,0x1C,0xDE,0xC1,0x1F,0xF8,0x01,0x0F,0x60,  // 122
+  0x07,0x05,0x16,0x00,0x00,0x00,0x00,0x03,0x00,0xE0,0x01,0xF8,0xCF,0x7F,0xFF,0xE1,0xFF,0x00,0x00,0x3C,0x00,0x00,0x03,  // 123
+  0x04,0x05,0x17,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,  // 124
+  0x07,0x05,0x16,0x00,0x00,0xC0,0x00,0x00,0x3C,0x00,0x00,0xFF,0x87,0xFF,0xFE,0xFB,0x1F,0x80,0x07,0x00,0xC0,0x00,0x00,  // 125
+  0x0D,0x0C,0x04,0x60,0x37,0x33,0x66,0xCC,0xEC,0x06,  // 126
+  0x05,0x09,0x12,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFC,0xFF,0xF3,0xFF,0x03,  // 161
+  0x0B,0x05,0x16,0x00,0x00,0x00,0xC0,0x0F,0x00,0xFC,0x07,0x80,0x83,0xF3,0x70,0xC0,0x03,0x0C,0x7E,0x00,0x7B,0x18,0xC0,0x01,0x06,0x6F,0xE0,0x00,0x38,0x1C,0x00,0x08,0x03,0x00,  // 162
+  0x0C,0x05,0x11,0x00,0x83,0x00,0x86,0xE3,0x8F,0xF3,0xFF,0x77,0xF0,0x6C,0x60,0xD8,0xC0,0xB0,0x81,0xC1,0x07,0x80,0x1D,0x00,0x33,0x00,0x07,0x00,0x04,  // 163
+  0x0D,0x08,0x0C,0x00,0x20,0x40,0xF7,0xEE,0x7F,0x0C,0x63,0x60,0x06,0x66,0x60,0x06,0xC6,0x30,0xFE,0x77,0xEF,0x02,0x04,  // 164
+  0x0D,0x05,0x11,0x07,0x33,0x1C,0x66,0xF0,0xCC,0x80,0x9F,0x01,0x3E,0x03,0xF0,0x3F,0xE0,0x7F,0xF0,0x19,0xF0,0x33,0x78,0x66,0x38,0xCC,0x38,0x98,0x11,0x00,0x00,  // 165
+  0x04,0x05,0x17,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0xF0,0xFF,0x7F,0xF8,0x0F,  // 166
+  0x0C,0x05,0x16,0x00,0x00,0x00,0xC0,0x01,0xC0,0xF9,0x60,0xF8,0x63,0x78,0x67,0x38,0xD8,0x38,0x0C,0x3C,0x0C,0x06,0x0F,0x86,0xC3,0x87,0xC3,0xB9,0xC3,0xE9,0xC7,0xE0,0xF3,0x00,0x70,0x00,  // 167
+  0x07,0x05,0x02,0x3C,0x3C,  // 168
+  0x12,0x05,0x11,0xC0,0x07,0xE0,0x3F,0xE0,0xE0,0x60,0x00,0xE3,0x3C,0xCE,0xFE,0xD9,0x0C,0xE3,0x0D,0xCC,0x1B,0x98,0x37,0x30,0x6F,0x60,0xDE,0xE1,0x6C,0xC3,0xCC,0x85,0x1C,0x03,0x18,0x1C,0x1C,0xF0,0x1F,0x80,0x0F,0x00,  // 169
+  0x07,0x05,0x09,0x00,0xCC,0xDD,0x9F,0x3C,0xF9,0xBF,0x7F,  // 170
+  0x0A,0x0A,0x0B,0x00,0x00,0x01,0x3E,0xBC,0x77,0xF0,0x10,0xE2,0xC3,0x7B,0x07,0x0F,0x20,  // 171
+  0x0C,0x0A,0x07,0x80,0xC1,0x60,0x30,0x18,0x0C,0x06,0x83,0xC1,0xFF,0x0F,  // 172
+  0x07,0x0F,0x02,0xFF,0x3F,  // 173
+  0x12,0x05,0x11,0xC0,0x07,0xE0,0x3F,0xE0,0xE0,0x60,0x00,0xE3,0x00,0xCE,0xFE,0xDB,0xFC,0xE7,0x99,0xC1,0x33,0x83,0x67,0x0E,0xCF,0x3F,0x1E,0xCF,0x6C,0x00,0xCD,0x01,0x1C,0x03,0x18,0x1C,0x1C,0xF0,0x1F,0x80,0x0F,0x00,  // 174
+  0x0D,0x02,0x02,0xFF,0xFF,0xFF,0x03,  // 175
+  0x08,0x05,0x07,0x00,0x8E,0x28,0x18,0x0C,0x8A,0x38,  // 176
+  0x0D,0x08,0x0E,0x00,0x00,0x18,0x0C,0x06,0x83,0xC1,0x60,0x30,0x18,0xFC,0xFF,0xFF,0xFF,0x60,0x30,0x18,0x0C,0x06,0x83,0xC1,0x60,0x30,  // 177
+  0x07,0x05,0x09,0x02,0x07,0x07,0x0F,0x1B,0xF3,0xA3,0x43,  // 178
+  0x07,0x05,0x09,0x82,0x06,0x07,0x8C,0x18,0xF1,0xBD,0x3B,  // 179
+  0x07,0x05,0x03,0x00,0xF8,0x05,  // 180
+  0x0C,0x09,0x12,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0xFF,0x00,0x0E,0x00,0x60,0x00,0x80,0x01,0x00,0x06,0x00,0x18,0x00,0x38,0xF0,0xFF,0xC1,0xFF,0x07,  // 181
+  0x0D,0x05,0x16,0x78,0x00,0x80,0x7F,0x00,0xE0,0x1F,0x00,0xFC,0x0F,0x00,0xFF,0x03,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0x03,0x00,0xC0,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x00,0x00,0x03,0x00,0x00,  // 182
+  0x05,0x0D,0x02,0xC0,0x03,  // 183
+  0x06,0x16,0x04,0x80,0xB8,0x4E,  // 184
+  0x06,0x05,0x09,0x00,0x18,0x18,0x30,0xF0,0xFF,0x3F,  // 185
+  0x08,0x05,0x09,0x00,0xF8,0xF8,0x3B,0x3E,0xF8,0xB8,0x3F,0x3E,  // 186
+  0x0C,0x0A,0x0B,0x00,0x00,0x00,0x00,0x02,0x78,0x70,0xEF,0xE1,0x23,0x84,0x07,0xF7,0x1E,0x3E,0x40,0x00,  // 187
+  0x14,0x05,0x11,0x00,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0xF8,0x1F,0xFC,0x3F,0x1C,0x00,0x1C,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x00,0x07,0x00,0x07,0x00,0x07,0x8C,0x03,0x9C,0x03,0x2E,0x03,0x46,0x00,0xFE,0x03,0xFC,0x07,0x00,0x02,  // 188
+  0x13,0x05,0x11,0x00,0x00,0x18,0x00,0x18,0x00,0x30,0x00,0xF8,0x1F,0xF8,0x3F,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x00,0x27,0x10,0x67,0xB0,0x43,0xF0,0x83,0xB0,0x03,0x31,0x01,0x7E,0x02,0x38,0x04,  // 189
+  0x13,0x05,0x11,0x82,0x00,0x06,0x03,0x04,0x04,0x88,0x08,0x18,0x11,0xF8,0x3D,0xB8,0x3B,0x1C,0x00,0x1C,0x00,0x1C,0x00,0x0E,0x00,0x0E,0x00,0x0E,0x00,0x07,0x06,0x07,0x0E,0x07,0x97,0x03,0x23,0x03,0xFF,0x03,0xFE,0x03,0x00,0x01,  // 190
+  0x0D,0x09,0x12,0x00,0x00,0x00,0x00,0x00,0x80,0x07,0x00,0x7F,0x00,0x8F,0x01,0x0E,0x3E,0x1F,0xF0,0x3C,0xC0,0x00,0x00,0x03,0x00,0x0E,0x00,0x1C,0x00,0x38,0x00,0x60,0x00,  // 191
+  0x0F,0x01,0x15,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x82,0x8F,0xC1,0x7C,0x30,0xB8,0x01,0x06,0xF4,0xC1,0x00,0xF8,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06,  // 192
+  0x0F,0x01,0x15,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x80,0x8F,0x01,0x7D,0x30,0xB8,0x01,0x06,0xF3,0xC1,0x20,0xF8,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06,  // 193
+  0x0F,0x01,0x15,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x88,0x8F,0x81,0x7D,0x30,0x98,0x01,0x06,0xF3,0xC1,0xC0,0xF8,0x18,0x10,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06,  // 194
+  0x0F,0x01,0x15,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x60,0xF0,0x0F,0x8E,0x8F,0xC1,0x7C,0x30,0x98,0x01,0x06,0xF6,0xC1,0xC0,0xF8,0x18,0x1C,0xFC,0x83,0x01,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06,  // 195
+  0x0F,0x02,0x14,0x00,0x00,0x0C,0x00,0xF8,0x00,0xE0,0x03,0xC0,0x0F,0x80,0x7F,0x30,0x3E,0x06,0xFB,0x60,0x80,0x01,0x06,0xF8,0x60,0x30,0x3E,0x06,0x83,0x7F,0x00,0xC0,0x0F,0x00,0xE0,0x03,0x00,0xF8,0x00,0x00,0x0C,  // 196
+  0x0F,0x01,0x15,0x00,0x00,0x18,0x00,0xE0,0x03,0x00,0x1F,0x00,0xFC,0x00,0xF0,0x0F,0x9C,0x8F,0x41,0x7C,0x30,0x88,0x01,0x06,0xF1,0xC1,0xC0,0xF9,0x18,0x00,0xFC,0x03,0x00,0xFC,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x06,  // 197
+  0x17,0x05,0x11,0x00,0x80,0x01,0xC0,0x03,0xE0,0x01,0xF0,0x00,0xF8,0x00,0xBC,0x01,0x1E,0x03,0x0F,0x06,0x07,0x0C,0x06,0x18,0x0C,0x30,0xF8,0xFF,0xFF,0xFF,0x7F,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x03,0x0F,0x06,0x1E,0x0C,0x3C,0x18,0x78,0x30,0xF0,0x00,0x60,  // 198
+  0x10,0x05,0x15,0x00,0x00,0x00,0xFC,0x01,0xE0,0xFF,0x00,0x1E,0x3C,0xE0,0x00,0x0E,0x0C,0x80,0xC1,0x00,0x60,0x1C,0x00,0x8C,0x03,0x80,0x77,0x00,0xB0,0x0F,0x00,0xA6,0x01,0xC0,0x60,0x00,0x0C,0x1C,0xC0,0x01,0x07,0x1E,0x80,0xC0,0x00,  // 199
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x7F,0xF8,0xFF,0x0F,0x83,0x81,0x61,0x30,0x70,0x0C,0x06,0x9E,0xC1,0xC0,0x37,0x18,0x98,0x06,0x03,0xC3,0x60,0x60,0x18,0x0C,0x0C,0x83,0x81,0x61,0x30,0x30,0x0C,0x00,0x06,  // 200
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x7F,0xF8,0xFF,0x0F,0x83,0x81,0x61,0x30,0x30,0x0C,0x06,0xA6,0xC1,0xC0,0x37,0x18,0x78,0x06,0x03,0xC7,0x60,0x60,0x18,0x0C,0x0C,0x83,0x81,0x61,0x30,0x30,0x0C,0x00,0x06,  // 201
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x7F,0xF8,0xFF,0x0F,0x83,0x81,0x61,0x30,0x30,0x0D,0x06,0xB6,0xC1,0xC0,0x33,0x18,0x78,0x06,0x03,0xDB,0x60,0x60,0x1A,0x0C,0x0C,0x83,0x81,0x61,0x30,0x30,0x0C,0x00,0x06,  // 202
+  0x0F,0x02,0x14,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x8F,0xFF,0xFF,0x18,0x0C,0x8C,0xC1,0xC0,0x1B,0x0C,0xBC,0xC1,0xC0,0x18,0x0C,0x8C,0xC1,0xC0,0x1B,0x0C,0xBC,0xC1,0xC0,0x18,0x0C,0x8C,0xC1,0xC0,0x18,0x00,0x0C,  // 203
+  0x05,0x01,0x15,0x00,0x00,0x20,0x00,0x00,0xCC,0xFF,0xFF,0xFB,0xFF,0x4F,0x00,0x00,0x00,  // 204
+  0x05,0x01,0x15,0x00,0x00,0x80,0x00,0x00,0xDC,0xFF,0xFF,0xF9,0xFF,0x1F,0x00,0x00,0x00,  // 205
+  0x06,0x01,0x15,0x04,0x00,0xC0,0x00,0x00,0xCC,0xFF,0xFF,0xF9,0xFF,0x6F,0x00,0x00,0x08,0x00,0x00,  // 206
+  0x06,0x02,0x14,0x03,0x00,0x30,0x00,0x00,0xF8,0xFF,0x8F,0xFF,0xFF,0x03,0x00,0x30,0x00,0x00,  // 207
+  0x10,0x05,0x11,0x80,0x01,0x00,0x03,0xFC,0xFF,0xFF,0xFF,0x3F,0x18,0x78,0x30,0xF0,0x60,0xE0,0xC1,0xC0,0x83,0x81,0x07,0x00,0x0F,0x00,0x3E,0x00,0xE6,0x00,0x8E,0x03,0x0E,0xFE,0x0F,0xF0,0x07,  // 208
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x7F,0xF8,0xFF,0x0F,0x0E,0x00,0x8C,0x03,0xC0,0xC1,0x01,0x18,0xF0,0x00,0x03,0x38,0xC0,0x00,0x1E,0x18,0x00,0x87,0x03,0xC0,0x33,0x00,0xE0,0xE0,0xFF,0x3F,0xFC,0xFF,0x07,  // 209
+  0x12,0x01,0x15,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFE,0x0F,0xE0,0xC1,0x03,0x0E,0xE0,0xC0,0x00,0x18,0x1C,0x00,0x8F,0x01,0xC0,0x33,0x00,0xF8,0x06,0x00,0xD3,0x00,0x60,0x18,0x00,0x0C,0x07,0xC0,0xC1,0x00,0x18,0x38,0x80,0x03,0x1E,0x3C,0x80,0xFF,0x03,0xC0,0x1F,0x00,  // 210
+  0x12,0x01,0x15,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFE,0x0F,0xE0,0xC1,0x03,0x0E,0xE0,0xC0,0x00,0x18,0x1C,0x00,0x87,0x01,0xC0,0x34,0x00,0xF8,0x06,0x00,0xCF,0x00,0xE0,0x18,0x00,0x0C,0x07,0xC0,0xC1,0x00,0x18,0x38,0x80,0x03,0x1E,0x3C,0x80,0xFF,0x03,0xC0,0x1F,0x00,  // 211
+  0x12,0x01,0x15,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFE,0x0F,0xE0,0xC1,0x03,0x0E,0xE0,0xC0,0x00,0x18,0x1C,0x00,0xA7,0x01,0xC0,0x36,0x00,0x78,0x06,0x00,0xCF,0x00,0x60,0x1B,0x00,0x4C,0x07,0xC0,0xC1,0x00,0x18,0x38,0x80,0x03,0x1E,0x3C,0x80,0xFF,0x03,0xC0,0x1F,0x00,  // 212
+  0x12,0x01,0x15,0x00,0x00,0x00,0xC0,0x1F,0x00,0xFE,0x0F,0xE0,0xC1,0x03,0x0E,0xE0,0xCC,0x00,0xD8,0x1D,0x00,0x9F,0x01,0xC0,0x33,0x00,0xD8,0x06,0x00,0xDB,0x00,0xE0,0x1B,0x00,0x3C,0x07,0xC0,0xC1,0x00,0x18,0x38,0x80,0x03,0x1E,0x3C,0x80,0xFF,0x03,0xC0,0x1F,0x00,  // 213
+  0x12,0x02,0x14,0x00,0x00,0x00,0xF0,0x07,0xC0,0xFF,0x01,0x1E,0x3C,0x70,0x00,0x07,0x03,0x60,0x38,0x00,0xBE,0x01,0xC0,0x1B,0x00,0x8C,0x01,0xC0,0x18,0x00,0xBC,0x01,0xC0,0x3B,0x00,0x0E,0x03,0x60,0x70,0x00,0x07,0x1E,0x3C,0xC0,0xFF,0x01,0xF0,0x07,  // 214
+  0x0B,0x09,0x09,0x00,0x00,0x0C,0x3E,0xEE,0x8E,0x0F,0x0E,0x3E,0xEE,0x8E,0x0F,0x06,  // 215
+  0x12,0x04,0x13,0x00,0x00,0x00,0xFE,0x10,0xFC,0xDF,0xF1,0xE0,0xC7,0x01,0x1E,0x06,0xF8,0x38,0xE0,0xCE,0x80,0x63,0x06,0x0E,0x33,0x38,0x98,0xE1,0xC0,0x8C,0x03,0xE6,0x0E,0x38,0x3E,0xC0,0xF0,0x00,0xC7,0x0F,0x1E,0xF7,0x7F,0x10,0xFE,0x00,  // 216
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0xF8,0xFF,0x03,0x00,0xE0,0x00,0x00,0x78,0x00,0x00,0x1E,0x00,0xC0,0x07,0x00,0x98,0x00,0x00,0x03,0x00,0x60,0x00,0x00,0x0E,0x00,0xE0,0xE0,0xFF,0x0F,0xFC,0x7F,0x00,  // 217
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0xF8,0xFF,0x03,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0x26,0x00,0xC0,0x07,0x00,0x78,0x00,0x00,0x07,0x00,0x60,0x00,0x00,0x0E,0x00,0xE0,0xE0,0xFF,0x0F,0xFC,0x7F,0x00,  // 218
+  0x0F,0x01,0x15,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0xF8,0xFF,0x03,0x00,0xE0,0x00,0x00,0x38,0x01,0x00,0x36,0x00,0xC0,0x03,0x00,0x78,0x00,0x00,0x1B,0x00,0x60,0x02,0x00,0x0E,0x00,0xE0,0xE0,0xFF,0x0F,0xFC,0x7F,0x00,  // 219
+  0x0F,0x02,0x14,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x80,0xFF,0x3F,0x00,0x00,0x07,0x00,0xE0,0x03,0x00,0x3C,0x00,0xC0,0x00,0x00,0x0C,0x00,0xC0,0x03,0x00,0x3C,0x00,0xE0,0x00,0x00,0x87,0xFF,0x3F,0xF8,0xFF,0x00,  // 220
+  0x10,0x01,0x15,0x10,0x00,0x00,0x06,0x00,0x80,0x03,0x00,0xE0,0x00,0x00,0x38,0x00,0x00,0x1E,0x00,0x80,0x07,0x20,0xC0,0xFF,0x07,0xF8,0x7F,0xC0,0x03,0x04,0x3C,0x00,0xC0,0x01,0x00,0x1E,0x00,0xE0,0x01,0x00,0x0C,0x00,0x80,0x00,0x00,  // 221
+  0x0F,0x05,0x11,0x00,0x00,0x00,0x00,0xFC,0xFF,0xFF,0xFF,0x8F,0x01,0x03,0x03,0x06,0x06,0x0C,0x0C,0x18,0x18,0x30,0x30,0x60,0x60,0xC0,0xC0,0xC0,0x01,0xC3,0x01,0xFE,0x01,0xF0,0x01,  // 222
+  0x0E,0x05,0x11,0x00,0x00,0x00,0x00,0xF0,0xFF,0xF7,0xFF,0x6F,0x00,0x60,0x00,0xC8,0x00,0xB8,0x01,0xE0,0xC7,0x83,0xFD,0x07,0xF3,0x18,0x06,0x60,0x0E,0xC0,0x0F,0x00,0x0F,  // 223
+  0x0C,0x05,0x11,0x00,0x00,0x80,0xE1,0x80,0xE3,0x03,0x63,0x1E,0xC3,0x78,0x86,0xF1,0x8D,0x61,0x1A,0x63,0x70,0x66,0xC0,0xFF,0x01,0xFF,0x07,0x00,0x08,  // 224
+  0x0C,0x05,0x11,0x00,0x00,0x80,0xE1,0x80,0xE3,0x03,0x63,0x0E,0xC3,0x98,0x86,0xF1,0x8D,0xE1,0x19,0x63,0x71,0x66,0xC0,0xFF,0x01,0xFF,0x07,0x00,0x08,  // 225
+  0x0C,0x05,0x11,0x00,0x00,0x80,0xE1,0x80,0xE3,0x23,0x63,0x6E,0xC3,0x78,0x86,0xF1,0x8C,0x61,0x1B,0x63,0x74,0x66,0xC0,0xFF,0x01,0xFF,0x07,0x00,0x08,  // 226
+  0x0C,0x05,0x11,0x00,0x00,0x80,0xE1,0x98,0xE3,0x3B,0x63,0x3E,0xC3,0x78,0x86,0xB1,0x8D,0x61,0x1B,0x63,0x77,0x66,0xC6,0xFF,0x01,0xFF,0x07,0x00,0x08,  // 227
+  0x0C,0x06,0x10,0x00,0x00,0x60,0x38,0x70,0x7C,0x33,0xE6,0x1B,0xC6,0x18,0xC6,0x18,0xC3,0x1B,0x63,0x3B,0x33,0xF0,0x7F,0xE0,0xFF,0x00,0x80,  // 228
+  0x0C,0x03,0x13,0x00,0x00,0x00,0x18,0x0E,0xE0,0xF8,0x00,0x63,0xEE,0x0C,0xE3,0x68,0x18,0x47,0x63,0x38,0x1A,0x63,0xCE,0x99,0x01,0xFC,0x1F,0xC0,0xFF,0x01,0x00,0x08,  // 229
+  0x15,0x09,0x0D,0x00,0x00,0xF1,0x38,0x3F,0x73,0x3E,0x86,0xC7,0xF0,0x18,0x1E,0xC3,0x33,0xEC,0xC6,0xF9,0x1F,0xFF,0x67,0xE6,0xCE,0xF8,0x18,0x1E,0xC3,0x63,0x78,0x0C,0x9B,0x31,0x3E,0x03,0x27,0x00,  // 230
+  0x0B,0x09,0x11,0x00,0x00,0xF0,0x07,0xF0,0x1F,0x70,0x70,0x70,0xC0,0x71,0x00,0xE3,0x00,0xDE,0x01,0xEC,0x07,0x9C,0x1C,0x1C,0x30,0x18,0x00,  // 231
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7E,0x00,0xFF,0x01,0x37,0x17,0x67,0x7C,0xC6,0xF0,0x8D,0x61,0x1A,0xC3,0x70,0xC6,0xC1,0x8D,0x01,0x9F,0x01,0x3C,0x01,  // 232
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7E,0x00,0xFF,0x01,0x37,0x07,0x67,0x9C,0xC6,0xF0,0x8D,0xE1,0x19,0xC3,0x71,0xC6,0xC1,0x8D,0x01,0x9F,0x01,0x3C,0x01,  // 233
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7E,0x00,0xFF,0x01,0x37,0x47,0x67,0xDC,0xC6,0xF0,0x8C,0xE1,0x19,0xC3,0x76,0xC6,0xC9,0x8D,0x01,0x9F,0x01,0x3C,0x01,  // 234
+  0x0C,0x06,0x10,0x00,0x00,0x80,0x1F,0xE0,0x3F,0x70,0x73,0x3B,0xE3,0x1B,0xC3,0x18,0xC3,0x18,0xC3,0x3B,0xE3,0x73,0x63,0xE0,0x33,0xC0,0x13,  // 235
+  0x05,0x05,0x11,0x00,0x00,0x02,0x00,0xCC,0xFF,0xBF,0xFF,0x4F,0x00,0x00,  // 236
+  0x05,0x05,0x11,0x00,0x00,0x08,0x00,0xDC,0xFF,0x9F,0xFF,0x1F,0x00,0x00,  // 237
+  0x06,0x05,0x11,0x04,0x00,0x0C,0x00,0xCC,0xFF,0x9F,0xFF,0x6F,0x00,0x80,0x00,0x00,  // 238
+  0x06,0x06,0x10,0x03,0x00,0x03,0x00,0xF8,0xFF,0xF8,0xFF,0x03,0x00,0x03,0x00,  // 239
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7F,0x00,0xFF,0x41,0x07,0xD7,0x07,0xBC,0x06,0xF0,0x0D,0x60,0x1B,0xC0,0x7E,0xC0,0xF3,0xC1,0x81,0xFF,0x01,0xF8,0x01,  // 240
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xC0,0xFF,0xB7,0xFF,0x7F,0x0C,0x60,0x0C,0xC0,0x0C,0x00,0x1B,0x00,0x36,0x00,0xEE,0x00,0x8C,0xFF,0x07,0xFE,0x0F,  // 241
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7F,0x00,0xFF,0x01,0x07,0x17,0x07,0x7C,0x06,0xF0,0x0D,0x60,0x1A,0xC0,0x70,0xC0,0xC1,0xC1,0x01,0xFF,0x01,0xFC,0x01,  // 242
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7F,0x00,0xFF,0x01,0x07,0x07,0x07,0x9C,0x06,0xF0,0x0D,0xE0,0x19,0xC0,0x71,0xC0,0xC1,0xC1,0x01,0xFF,0x01,0xFC,0x01,  // 243
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7F,0x00,0xFF,0x01,0x07,0x47,0x07,0xDC,0x06,0xF0,0x0C,0xE0,0x19,0xC0,0x76,0xC0,0xC9,0xC1,0x01,0xFF,0x01,0xFC,0x01,  // 244
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x7F,0x00,0xFF,0x31,0x07,0x77,0x07,0x7C,0x06,0xF0,0x0C,0x60,0x1B,0xC0,0x76,0xC0,0xCF,0xC1,0x0D,0xFF,0x01,0xFC,0x01,  // 245
+  0x0C,0x06,0x10,0x00,0x00,0xC0,0x1F,0xE0,0x3F,0x70,0x70,0x3B,0xE0,0x1B,0xC0,0x18,0xC0,0x18,0xC0,0x3B,0xE0,0x73,0x70,0xE0,0x3F,0xC0,0x1F,  // 246
+  0x0D,0x09,0x08,0x00,0x18,0x18,0x18,0x18,0x18,0xDB,0xDB,0x18,0x18,0x18,0x18,0x18,  // 247
+  0x0D,0x08,0x0F,0x00,0x00,0x00,0x00,0xFC,0x19,0xFF,0xCF,0xC1,0x71,0xF8,0x19,0xCE,0xCC,0x63,0x76,0x30,0x1F,0x1C,0x07,0xE7,0xFF,0x31,0x7F,0x00,  // 248
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xC0,0xFF,0x81,0xFF,0x17,0x00,0x7C,0x00,0xF0,0x01,0x60,0x02,0xC0,0x00,0xC0,0x00,0xC0,0xC0,0xFF,0x87,0xFF,0x0F,  // 249
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xC0,0xFF,0x81,0xFF,0x07,0x00,0x1C,0x00,0x30,0x01,0xE0,0x03,0xC0,0x03,0xC0,0x02,0xC0,0xC0,0xFF,0x87,0xFF,0x0F,  // 250
+  0x0C,0x05,0x11,0x00,0x00,0x00,0x00,0xC0,0xFF,0x81,0xFF,0x47,0x00,0xDC,0x00,0xF0,0x00,0xE0,0x01,0xC0,0x06,0xC0,0x08,0xC0,0xC0,0xFF,0x87,0xFF,0x0F,  // 251
+  0x0C,0x06,0x10,0x00,0x00,0x00,0x00,0xF8,0x3F,0xF8,0x7F,0x03,0xE0,0x03,0xC0,0x00,0xC0,0x00,0xC0,0x03,0x60,0x03,0x30,0xF8,0xFF,0xF8,0xFF,  // 252
+  0x0B,0x05,0x16,0x00,0x00,0x00,0x1C,0x00,0x00,0x3F,0x00,0x03,0x3E,0xC0,0x00,0x7C,0x38,0x01,0xFC,0x77,0x00,0x7E,0x0C,0xF8,0x03,0xC1,0x1F,0x00,0x7C,0x00,0x00,0x03,0x00,0x00,  // 253
+  0x0C,0x05,0x16,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0xFF,0xFF,0xFF,0xFF,0xE0,0xC0,0x00,0x0C,0x60,0x00,0x03,0x18,0xC0,0x00,0x06,0x70,0xC0,0x01,0x38,0x38,0x00,0xFC,0x07,0x00,0x7E,0x00,  // 254
+  0x0B,0x06,0x15,0x00,0x00,0x00,0x07,0x00,0xE0,0x07,0xE0,0xE1,0x03,0x3C,0xE0,0xC3,0x01,0xF0,0x1F,0x00,0xFC,0x18,0xF8,0x03,0xE3,0x0F,0x00,0x1F,0x00,0x60,0x00,0x00,  // 255
+};
+
+#endif
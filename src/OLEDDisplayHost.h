@@ -0,0 +1,176 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef OLEDDISPLAYHOST_h
+#define OLEDDISPLAYHOST_h
+
+/*
+ * A minimal Arduino emulation for POSIX hosts (Linux, macOS). It provides just
+ * enough of the Arduino core (String, Print, timing and PROGMEM helpers) to
+ * build the drawing, text and diff code on a workstation, e.g. to benchmark or
+ * profile it. Nothing in here talks to real hardware.
+ */
+
+#define OLEDDISPLAY_HOST
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+#define PROGMEM
+#define PGM_P                 const char *
+#define PSTR(s)               (s)
+#define pgm_read_byte(addr)   (*(const unsigned char *)(addr))
+
+// Flash strings are plain strings on the host
+class __FlashStringHelper;
+#define F(s)                  (reinterpret_cast<const __FlashStringHelper *>(PSTR(s)))
+
+// There is no serial console on the host, deprecation notices are dropped
+#ifndef NO_GLOBAL_SERIAL
+#define NO_GLOBAL_SERIAL
+#endif
+
+using std::min;
+using std::max;
+
+inline unsigned long micros() {
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+  return (unsigned long) std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long millis() {
+  return micros() / 1000;
+}
+
+inline void delay(unsigned long ms) {
+  std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+inline void yield() {}
+
+/*
+ * Subset of the Arduino String class used by the library and the examples
+ */
+class String {
+public:
+  String() {}
+  String(const char *s) : _str(s ? s : "") {}
+  String(const std::string &s) : _str(s) {}
+  explicit String(char c) : _str(1, c) {}
+  explicit String(int value) : _str(std::to_string(value)) {}
+  explicit String(unsigned int value) : _str(std::to_string(value)) {}
+  explicit String(long value) : _str(std::to_string(value)) {}
+  explicit String(unsigned long value) : _str(std::to_string(value)) {}
+
+  unsigned int length() const { return _str.length(); }
+  const char *c_str() const { return _str.c_str(); }
+  char charAt(unsigned int index) const { return index < _str.length() ? _str[index] : 0; }
+  char operator[](unsigned int index) const { return charAt(index); }
+
+  void toCharArray(char *buf, unsigned int bufsize, unsigned int index = 0) const {
+    if (!bufsize || !buf) return;
+    size_t len = index < _str.length() ? std::min<size_t>(bufsize - 1, _str.length() - index) : 0;
+    memcpy(buf, _str.c_str() + index, len);
+    buf[len] = 0;
+  }
+
+  String substring(unsigned int from) const {
+    return from < _str.length() ? String(_str.substr(from)) : String();
+  }
+  String substring(unsigned int from, unsigned int to) const {
+    if (from > to) std::swap(from, to);
+    return from < _str.length() ? String(_str.substr(from, to - from)) : String();
+  }
+
+  String &operator+=(const String &rhs) { _str += rhs._str; return *this; }
+  String &operator+=(const char *rhs) { _str += rhs; return *this; }
+  String &operator+=(char rhs) { _str += rhs; return *this; }
+  bool operator==(const String &rhs) const { return _str == rhs._str; }
+  bool operator!=(const String &rhs) const { return _str != rhs._str; }
+
+  friend String operator+(const String &lhs, const String &rhs) { return String(lhs._str + rhs._str); }
+  friend String operator+(const String &lhs, const char *rhs) { return String(lhs._str + rhs); }
+  friend String operator+(const char *lhs, const String &rhs) { return String(lhs + rhs._str); }
+
+private:
+  std::string _str;
+};
+
+/*
+ * Subset of the Arduino Print class, everything ends up in write(uint8_t)
+ */
+class Print {
+public:
+  virtual ~Print() {}
+
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t *buffer, size_t size) {
+    size_t n = 0;
+    while (size--) {
+      n += write(*buffer++);
+    }
+    return n;
+  }
+  size_t write(const char *str) {
+    return str ? write((const uint8_t *) str, strlen(str)) : 0;
+  }
+
+  size_t print(const char *str) { return write(str); }
+  size_t print(const String &str) { return write((const uint8_t *) str.c_str(), str.length()); }
+  size_t print(char c) { return write((uint8_t) c); }
+  size_t print(int value) { return print(String(value)); }
+  size_t print(unsigned int value) { return print(String(value)); }
+  size_t print(long value) { return print(String(value)); }
+  size_t print(unsigned long value) { return print(String(value)); }
+
+  size_t println() { return write("\r\n"); }
+  template <typename T> size_t println(T value) { return print(value) + println(); }
+
+  size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3))) {
+    char buf[256];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(buf, sizeof(buf), format, args);
+    va_end(args);
+    if (len < 0) return 0;
+    return write((const uint8_t *) buf, std::min<size_t>(len, sizeof(buf) - 1));
+  }
+};
+
+#endif
@@ -53,7 +53,16 @@ OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
   overlayCount = 0;
   indicatorDrawState = 1;
   loadingDrawFunction = LoadingDrawDefault;
-  updateInterval = 33;
+  updateInterval = 33333;
+  frameScheduled = false;
+  frameReady = false;
+  frameAdvanced = false;
+  renderAhead = false;
+  redrawIn = 0;
+  framesUnchanged = 0;
+  idle = false;
+  redrawRequested = false;
+  resetStats();
   state.lastUpdate = 0;
   state.ticksSinceLastStateSwitch = 0;
   state.frameState = FIXED;
@@ -61,6 +70,7 @@ OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
   state.frameTransitionDirection = 1;
   state.isIndicatorDrawn = true;
   state.manualControl = false;
+  state.redrawIn = 0;
   state.userData = NULL;
   shouldDrawIndicators = true;
   autoTransition = true;
@@ -70,13 +80,19 @@ OLEDDisplayUi::OLEDDisplayUi(OLEDDisplay *display) {
 
 void OLEDDisplayUi::init() {
   this->display->init();
+  this->resetStats();
 }
 
 void OLEDDisplayUi::setTargetFPS(uint8_t fps){
-  this->updateInterval = ((float) 1.0 / (float) fps) * 1000;
+  if (fps == 0) return;
+  this->updateInterval = 1000000UL / fps;
 
-  this->ticksPerFrame = timePerFrame / updateInterval;
-  this->ticksPerTransition = timePerTransition / updateInterval;
+  this->ticksPerFrame = (uint32_t) timePerFrame * 1000 / updateInterval;
+  this->ticksPerTransition = (uint32_t) timePerTransition * 1000 / updateInterval;
+}
+
+void OLEDDisplayUi::setRenderAhead(bool enabled){
+  this->renderAhead = enabled;
 }
 
 // -/------ Automatic controll ------\-
@@ -97,11 +113,11 @@ void OLEDDisplayUi::setAutoTransitionBackwards(){
 }
 void OLEDDisplayUi::setTimePerFrame(uint16_t time){
   this->timePerFrame = time;
-  this->ticksPerFrame = timePerFrame / updateInterval;
+  this->ticksPerFrame = (uint32_t) timePerFrame * 1000 / updateInterval;
 }
 void OLEDDisplayUi::setTimePerTransition(uint16_t time){
   this->timePerTransition = time;
-  this->ticksPerTransition = timePerTransition / updateInterval;
+  this->ticksPerTransition = (uint32_t) timePerTransition * 1000 / updateInterval;
 }
 
 // -/------ Customize indicator position and style -------\-
@@ -115,10 +131,12 @@ void OLEDDisplayUi::disableIndicator(){
 
 void OLEDDisplayUi::enableAllIndicators(){
   this->shouldDrawIndicators = true;
+  this->invalidate();
 }
 
 void OLEDDisplayUi::disableAllIndicators(){
   this->shouldDrawIndicators = false;
+  this->invalidate();
 }
 
 void OLEDDisplayUi::setIndicatorPosition(IndicatorPosition pos) {
@@ -149,6 +167,7 @@ void OLEDDisplayUi::setFrames(FrameCallback* frameFunctions, uint8_t frameCount)
 void OLEDDisplayUi::setOverlays(OverlayCallback* overlayFunctions, uint8_t overlayCount){
   this->overlayFunctions = overlayFunctions;
   this->overlayCount     = overlayCount;
+  this->invalidate();
 }
 
 // -/----- Loading Process -----\-
@@ -182,6 +201,7 @@ void OLEDDisplayUi::runLoadingProcess(LoadingStage* stages, uint8_t stagesCount)
 // -/----- Manual control -----\-
 void OLEDDisplayUi::nextFrame() {
   if (this->state.frameState != IN_TRANSITION) {
+    this->invalidate();
     this->state.manualControl = true;
     this->state.frameState = IN_TRANSITION;
     this->state.ticksSinceLastStateSwitch = 0;
@@ -191,6 +211,7 @@ void OLEDDisplayUi::nextFrame() {
 }
 void OLEDDisplayUi::previousFrame() {
   if (this->state.frameState != IN_TRANSITION) {
+    this->invalidate();
     this->state.manualControl = true;
     this->state.frameState = IN_TRANSITION;
     this->state.ticksSinceLastStateSwitch = 0;
@@ -201,6 +222,7 @@ void OLEDDisplayUi::previousFrame() {
 
 void OLEDDisplayUi::switchToFrame(uint8_t frame) {
   if (frame >= this->frameCount) return;
+  this->invalidate();
   this->state.ticksSinceLastStateSwitch = 0;
   if (frame == this->state.currentFrame) return;
   this->state.frameState = FIXED;
@@ -210,6 +232,7 @@ void OLEDDisplayUi::switchToFrame(uint8_t frame) {
 
 void OLEDDisplayUi::transitionToFrame(uint8_t frame) {
   if (frame >= this->frameCount) return;
+  this->invalidate();
   this->state.ticksSinceLastStateSwitch = 0;
   if (frame == this->state.currentFrame) return;
   this->nextFrameNumber = frame;
@@ -219,39 +242,186 @@ void OLEDDisplayUi::transitionToFrame(uint8_t frame) {
   this->state.frameTransitionDirection = frame < this->state.currentFrame ? -1 : 1;
 }
 
+void OLEDDisplayUi::invalidate() {
+  if (this->idle) {
+    // The ticks of the frames skipped so far pass before the caller changes
+    // the state, the next frame is due right away
+    uint32_t now = oled_micros();
+    this->skipFrames(now);
+    if ((int32_t) (now - this->frameDeadline) > 0) {
+      this->frameDeadline = now;
+    }
+  }
+  this->redrawRequested = true;
+  // A frame drawn ahead is drawn again, without advancing the state twice
+  this->frameReady = false;
+}
+
 
 // -/----- State information -----\-
 OLEDDisplayUiState* OLEDDisplayUi::getUiState(){
   return &this->state;
 }
 
+OLEDDisplayUiStats OLEDDisplayUi::getStats(){
+  OLEDDisplayUiStats current = this->stats;
+  current.averageRenderMicros = current.framesRendered ? this->renderMicros / current.framesRendered : 0;
+  current.averageFlushMicros = this->framesFlushed ? this->flushMicros / this->framesFlushed : 0;
+  return current;
+}
+
+void OLEDDisplayUi::resetStats(){
+  memset(&this->stats, 0, sizeof(this->stats));
+  this->framesFlushed = 0;
+  this->renderMicros = 0;
+  this->flushMicros = 0;
+}
+
 int16_t OLEDDisplayUi::update(){
-#ifdef ARDUINO
-  unsigned long frameStart = millis();
-#elif __MBED__
-	Timer t;
-	t.start();
-	unsigned long frameStart = t.read_ms();
-#else
-#error "Unkown operating system"
+  uint32_t now = oled_micros();
+  if (!this->frameScheduled) {
+    // The first frame is due right away
+    this->frameDeadline = now;
+    this->frameScheduled = true;
+  }
+
+  if (this->idle) {
+    if ((int32_t) (now - this->wakeDeadline) < 0) {
+      // Nothing changes before wakeDeadline, only the last frame is sent
+      if (this->display->isBusy()) {
+        this->display->poll();
+        this->flushMicros += oled_micros() - now;
+#ifndef OLEDDISPLAY_ASYNC_TASK
+        return 0;
 #endif
-  int32_t timeBudget = this->updateInterval - (frameStart - this->state.lastUpdate);
-  if ( timeBudget <= 0) {
-    // Implement frame skipping to ensure time budget is kept
-    if (this->autoTransition && this->state.lastUpdate != 0) this->state.ticksSinceLastStateSwitch += ceil((double)-timeBudget / (double)this->updateInterval);
+      }
+      int32_t sleep = (int32_t) (this->wakeDeadline - oled_micros()) / 1000;
+      return sleep > OLEDDISPLAYUI_MAX_SLEEP_MS ? OLEDDISPLAYUI_MAX_SLEEP_MS : sleep;
+    }
 
-    this->state.lastUpdate = frameStart;
-    this->tick();
+    this->skipFrames(this->wakeDeadline);
+  }
+
+  if ((int32_t) (now - this->frameDeadline) >= 0) {
+    if (!this->frameReady) {
+#ifndef OLEDDISPLAY_DOUBLE_BUFFER
+      // The running transfer sends the buffer itself
+      while (this->display->isBusy()) {
+        this->display->poll();
+      }
+#endif
+      this->renderFrame();
+    }
+    this->flushFrame(now);
+  } else if (this->display->isBusy()) {
+    // Send the previous frame a part per call
+    this->display->poll();
+    this->flushMicros += oled_micros() - now;
+  } else if (!this->frameReady && this->renderAhead) {
+    this->renderFrame();
   }
-#ifdef ARDUINO
-  return this->updateInterval - (millis() - frameStart);
-#elif __MBED__
-  return this->updateInterval - (t.read_ms() - frameStart);
+
+  // Come back right away while there is work to do before the deadline
+#ifdef OLEDDISPLAY_ASYNC_TASK
+  const bool sending = false;   // A task sends the frame
 #else
-#error "Unkown operating system"
+  const bool sending = this->display->isBusy();
 #endif
+  if (sending || (!this->frameReady && this->renderAhead)) {
+    return 0;
+  }
+  int32_t remaining = (int32_t) (this->frameDeadline - oled_micros()) / 1000;
+  return remaining > INT16_MAX ? INT16_MAX : remaining < INT16_MIN ? INT16_MIN : remaining;
+}
+
+void OLEDDisplayUi::renderFrame() {
+  uint32_t start = oled_micros();
+  this->state.lastUpdate = oled_millis();
+  if (!this->frameAdvanced) {
+    this->tick();
+    this->frameAdvanced = true;
+  }
+  this->redrawRequested = false;
+
+  this->display->clear();
+  this->drawFrame();
+  if (shouldDrawIndicators) {
+    this->drawIndicator();
+  }
+  this->drawOverlays();
+
+  this->framesUnchanged = this->countUnchangedFrames(start);
+  this->frameReady = true;
+  this->stats.framesRendered++;
+  this->renderMicros += oled_micros() - start;
 }
 
+void OLEDDisplayUi::skipFrames(uint32_t until) {
+  // The frames due before until looked the same, their ticks pass without
+  // drawing them
+  if ((int32_t) (until - this->frameDeadline) >= 0) {
+    uint32_t skipped = (until - this->frameDeadline) / this->updateInterval;
+    this->stats.framesSkipped += skipped;
+    this->state.ticksSinceLastStateSwitch += skipped;
+    this->frameDeadline += skipped * this->updateInterval;
+  }
+  this->idle = false;
+}
+
+uint32_t OLEDDisplayUi::countUnchangedFrames(uint32_t now) {
+  if (this->state.frameState != FIXED || this->redrawIn == 0 || this->redrawRequested) {
+    return 0;
+  }
+
+  // Number of the first frame after this one that has to be drawn, static
+  // content is drawn again every ~35 minutes
+  uint32_t frames = 0x7FFFFFFFUL / this->updateInterval;
+  if (this->redrawIn != OLEDDISPLAYUI_REDRAW_NEVER) {
+    // The content changes redrawIn ms from now, this frame is due at frameDeadline
+    int64_t change = (int32_t) (now - this->frameDeadline) + (int64_t) this->redrawIn * 1000;
+    if (change <= 0) return 0;
+    uint64_t due = (change + this->updateInterval - 1) / this->updateInterval;
+    if (due < frames) frames = due;
+  }
+  // The tick that starts the automatic transition
+  if (this->autoTransition) {
+    uint32_t ticks = this->ticksPerFrame > this->state.ticksSinceLastStateSwitch ? this->ticksPerFrame - this->state.ticksSinceLastStateSwitch : 1;
+    if (ticks < frames) frames = ticks;
+  }
+  return frames - 1;
+}
+
+void OLEDDisplayUi::flushFrame(uint32_t now) {
+  // The deadlines that passed while the frame waited are dropped, with
+  // automatic transitions their ticks are skipped to keep the pace
+  uint32_t late = now - this->frameDeadline;
+  uint32_t missed = late / this->updateInterval;
+  if (missed) {
+    this->stats.framesDropped += missed;
+    if (this->autoTransition) this->state.ticksSinceLastStateSwitch += missed;
+    this->frameDeadline += missed * this->updateInterval;
+  }
+  if (late > OLEDDISPLAYUI_LATE_FLUSH_MICROS) {
+    this->stats.lateFlushes++;
+  }
+  this->frameDeadline += this->updateInterval;
+
+  // The previous frame has to be complete before this one is sent
+  uint32_t start = oled_micros();
+  while (!this->display->displayAsync()) {
+    this->display->poll();
+  }
+  this->frameReady = false;
+  this->frameAdvanced = false;
+  this->framesFlushed++;
+  this->flushMicros += oled_micros() - start;
+
+  // The frames that look the same are skipped, less the ones missed already
+  if (this->framesUnchanged > missed) {
+    this->idle = true;
+    this->wakeDeadline = this->frameDeadline + (this->framesUnchanged - missed) * this->updateInterval;
+  }
+}
 
 void OLEDDisplayUi::tick() {
   this->state.ticksSinceLastStateSwitch++;
@@ -279,18 +449,14 @@ void OLEDDisplayUi::tick() {
       }
       break;
   }
-
-  this->display->clear();
-  this->drawFrame();
-  if (shouldDrawIndicators) {
-    this->drawIndicator();
-  }
-  this->drawOverlays();
-  this->display->display();
 }
 
 void OLEDDisplayUi::resetState() {
   this->state.lastUpdate = 0;
+  this->frameScheduled = false;
+  this->frameReady = false;
+  this->frameAdvanced = false;
+  this->idle = false;
   this->state.ticksSinceLastStateSwitch = 0;
   this->state.frameState = FIXED;
   this->state.currentFrame = 0;
@@ -342,12 +508,17 @@ void OLEDDisplayUi::drawFrame(){
 
        // Probe each frameFunction for the indicator drawn state
        this->enableIndicator();
+       this->state.redrawIn = 0;
        (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, x, y);
        drawnCurrentFrame = this->state.isIndicatorDrawn;
 
        this->enableIndicator();
+       this->state.redrawIn = 0;
        (this->frameFunctions[this->getNextFrameNumber()])(this->display, &this->state, x1, y1);
 
+       // Transitions change every frame
+       this->redrawIn = 0;
+
        // Build up the indicatorDrawState
        if (drawnCurrentFrame && !this->state.isIndicatorDrawn) {
          // Drawn now but not next
@@ -371,7 +542,9 @@ void OLEDDisplayUi::drawFrame(){
       // And set indicatorDrawState to "not known yet"
       this->indicatorDrawState = 0;
       this->enableIndicator();
+      this->state.redrawIn = 0;
       (this->frameFunctions[this->state.currentFrame])(this->display, &this->state, 0, 0);
+      this->redrawIn = this->state.redrawIn;
       break;
   }
 }
@@ -461,7 +634,9 @@ void OLEDDisplayUi::drawIndicator() {
 
 void OLEDDisplayUi::drawOverlays() {
  for (uint8_t i=0;i<this->overlayCount;i++){
+    this->state.redrawIn = 0;
     (this->overlayFunctions[i])(this->display, &this->state);
+    if (this->state.redrawIn < this->redrawIn) this->redrawIn = this->state.redrawIn;
  }
 }
 
@@ -36,6 +36,8 @@
 #include <Arduino.h>
 #elif __MBED__
 #include <mbed.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include "OLEDDisplayHost.h"
 #else
 #error "Unkown operating system"
 #endif
@@ -48,6 +50,22 @@
 #define DEBUG_OLEDDISPLAYUI(...)
 #endif
 
+// A frame sent more than this many microseconds after it was due counts as a
+// late flush, see getStats()
+#ifndef OLEDDISPLAYUI_LATE_FLUSH_MICROS
+#define OLEDDISPLAYUI_LATE_FLUSH_MICROS 1000
+#endif
+
+// Longest time update() returns while the frames look the same, so a loop
+// that sleeps for it still checks its buttons and calls invalidate() in time
+#ifndef OLEDDISPLAYUI_MAX_SLEEP_MS
+#define OLEDDISPLAYUI_MAX_SLEEP_MS 1000
+#endif
+
+// OLEDDisplayUiState::redrawIn of frames and overlays that only change when
+// OLEDDisplayUi::invalidate() is called
+#define OLEDDISPLAYUI_REDRAW_NEVER 0xFFFFFFFF
+
 enum AnimationDirection {
   SLIDE_UP,
   SLIDE_DOWN,
@@ -97,10 +115,26 @@ struct OLEDDisplayUiState {
 
   bool          manualControl;
 
+  // Frames and overlays that don't change every frame set this while drawing
+  // to the time in ms until they look different, OLEDDISPLAYUI_REDRAW_NEVER
+  // if they are static. It is 0 (changes every frame) before each of them is
+  // drawn. The Ui skips frames until one of them changes.
+  uint32_t      redrawIn;
+
   // Custom data that can be used by the user
   void*         userData;
 };
 
+// Frame pacing of update() since init() or resetStats()
+struct OLEDDisplayUiStats {
+  uint32_t framesRendered;
+  uint32_t framesDropped;       // Deadlines that passed before their frame was sent
+  uint32_t framesSkipped;       // Not drawn as they would have looked the same
+  uint32_t lateFlushes;         // Frames sent later than OLEDDISPLAYUI_LATE_FLUSH_MICROS
+  uint32_t averageRenderMicros; // Drawing frame, indicator and overlays
+  uint32_t averageFlushMicros;  // Time update() spends sending a frame
+};
+
 struct LoadingStage {
   const char* process;
   void (*callback)();
@@ -156,12 +190,31 @@ class OLEDDisplayUi {
     // UI State
     OLEDDisplayUiState      state;
 
-    // Bookeeping for update
-    uint16_t            updateInterval            = 33;
+    // Bookeeping for update, times in microseconds. Frames are due on a
+    // fixed grid of deadlines updateInterval apart.
+    uint32_t            updateInterval;
+    uint32_t            frameDeadline;            // oled_micros() the next frame is due at
+    bool                frameScheduled;           // frameDeadline is set
+    bool                frameReady;               // The next frame is in the buffer
+    bool                frameAdvanced;            // tick() ran for the next frame
+    bool                renderAhead;
+
+    // Skipping frames that look like the one before
+    uint32_t            redrawIn;                 // Of all frames and overlays drawn
+    uint32_t            framesUnchanged;          // After the one in the buffer
+    bool                idle;                     // Nothing to draw before wakeDeadline
+    bool                redrawRequested;          // invalidate() was called
+    uint32_t            wakeDeadline;
 
     uint16_t            timePerFrame;
     uint16_t            timePerTransition;
 
+    // Totals behind getStats()
+    OLEDDisplayUiStats  stats;
+    uint32_t            framesFlushed;
+    uint64_t            renderMicros;
+    uint64_t            flushMicros;
+
     uint8_t             getNextFrameNumber();
     void                drawIndicator();
     void                drawFrame();
@@ -169,6 +222,16 @@ class OLEDDisplayUi {
     void                tick();
     void                resetState();
 
+    // The two phases of a frame: advancing the state and drawing it into the
+    // buffer, then sending it once it is due
+    void                renderFrame();
+    void                flushFrame(uint32_t now);
+
+    // Frames after the one just drawn that will look the same
+    uint32_t            countUnchangedFrames(uint32_t now);
+    // Ends the sleep of an idle Ui, the frames due before until are skipped
+    void                skipFrames(uint32_t until);
+
   public:
 
     OLEDDisplayUi(OLEDDisplay *display);
@@ -183,6 +246,15 @@ class OLEDDisplayUi {
      */
     void setTargetFPS(uint8_t fps);
 
+    /**
+     * Draw the next frame as soon as the previous one was sent instead of
+     * when it is due (the default). The frame is then only sent at its
+     * deadline, which keeps the pace even if drawing takes long, at the cost
+     * of running the frame and overlay callbacks up to a frame earlier and
+     * of update() returning 0 until the frame is drawn.
+     */
+    void setRenderAhead(bool enabled);
+
     // Automatic Control
     /**
      * Enable automatic transition to next frame after the some time can be configured with `setTimePerFrame` and `setTimePerTransition`.
@@ -307,9 +379,28 @@ class OLEDDisplayUi {
      */
     void transitionToFrame(uint8_t frame);
 
+    /**
+     * Draw the next frame even if the frames and overlays reported that
+     * nothing changes, e.g. when the data they show changed
+     */
+    void invalidate();
+
     // State Info
     OLEDDisplayUiState* getUiState();
 
+    /**
+     * Frames rendered and dropped, late flushes and the average time drawing
+     * and sending a frame take
+     */
+    OLEDDisplayUiStats getStats();
+    void resetStats();
+
+    /**
+     * Call this in the main loop. Each call does one step: drawing the next
+     * frame, sending a part of the previous one or sending a frame that is
+     * due. Returns the time in ms until the next frame is due, 0 while there
+     * is more to do before.
+     */
     int16_t update();
 };
 #endif
@@ -61,69 +61,43 @@ class SH1106Brzo : public OLEDDisplay {
     }
 
     void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (displayHeight / 8); y++) {
-         for (x = 0; x < displayWidth; x++) {
-          uint16_t pos = x + y * displayWidth;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
+       uint8_t rects = getDirtyRects();
+       if (rects == 0) return;
 
-       uint8_t k = 0;
        uint8_t sendBuffer[17];
        sendBuffer[0] = 0x40;
 
-       // Calculate the colum offset
-       uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-       uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
        brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
 
-       for (y = minBoundY; y <= maxBoundY; y++) {
-         sendCommand(0xB0 + y);
-         sendCommand(minBoundXp2H);
-         sendCommand(minBoundXp2L);
-         for (x = minBoundX; x <= maxBoundX; x++) {
-             k++;
-             sendBuffer[k] = buffer[x + y * displayWidth];
-             if (k == 16)  {
-               brzo_i2c_write(sendBuffer, 17, true);
-               k = 0;
-             }
-         }
-         if (k != 0) {
-           brzo_i2c_write(sendBuffer, k + 1, true);
-           k = 0;
+       for (uint8_t r = 0; r < rects; r++) {
+         const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+         uint8_t x, y;
+         uint8_t k = 0;
+
+         // Calculate the colum offset
+         uint8_t minBoundXp2H = (rect.x0 + 2) & 0x0F;
+         uint8_t minBoundXp2L = 0x10 | ((rect.x0 + 2) >> 4 );
+
+         for (y = rect.page0; y <= rect.page1; y++) {
+           sendCommand(0xB0 + ramPage(y));
+           sendCommand(minBoundXp2H);
+           sendCommand(minBoundXp2L);
+           for (x = rect.x0; x <= rect.x1; x++) {
+               k++;
+               sendBuffer[k] = buffer[x + y * displayWidth];
+               if (k == 16)  {
+                 brzo_i2c_write(sendBuffer, 17, true);
+                 k = 0;
+               }
+           }
+           if (k != 0) {
+             brzo_i2c_write(sendBuffer, k + 1, true);
+             k = 0;
+           }
+           yield();
          }
-         yield();
-       }
-       if (k != 0) {
-         brzo_i2c_write(sendBuffer, k + 1, true);
        }
        brzo_i2c_end_transaction();
-     #else
-     #endif
     }
 
   private:
@@ -136,6 +110,11 @@ class SH1106Brzo : public OLEDDisplay {
       brzo_i2c_write(command, 2, true);
       brzo_i2c_end_transaction();
     }
+
+    // The SH1106 has no scroll engine
+    bool supportsScrollEngine(void) {
+      return false;
+    }
 };
 
 #endif
@@ -70,68 +70,14 @@ class SH1106Spi : public OLEDDisplay {
     }
 
     void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (displayHeight / 8); y++) {
-         for (x = 0; x < displayWidth; x++) {
-          uint16_t pos = x + y * displayWidth;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
-
-       // Calculate the colum offset
-       uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-       uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
-       for (y = minBoundY; y <= maxBoundY; y++) {
-         sendCommand(0xB0 + y);
-         sendCommand(minBoundXp2H);
-         sendCommand(minBoundXp2L);
-         set_CS(HIGH);
-         digitalWrite(_dc, HIGH);   // data mode
-         set_CS(LOW);
-         for (x = minBoundX; x <= maxBoundX; x++) {
-           SPI.transfer(buffer[x + y * displayWidth]);
+       uint8_t rects = getDirtyRects();
+       for (uint8_t r = 0; r < rects; r++) {
+         const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+         for (uint8_t y = rect.page0; y <= rect.page1; y++) {
+           sendRegionRow(rect, y, &buffer[rect.x0 + y * displayWidth]);
+           yield();
          }
-         set_CS(HIGH);
-         yield();
        }
-     #else
-      for (uint8_t y=0; y<displayHeight/8; y++) {
-        sendCommand(0xB0 + y);
-        sendCommand(0x02);
-        sendCommand(0x10);
-        set_CS(HIGH);
-        digitalWrite(_dc, HIGH);   // data mode
-        set_CS(LOW);
-        for( uint8_t x=0; x < displayWidth; x++) {
-          SPI.transfer(buffer[x + y * displayWidth]);
-        }
-        set_CS(HIGH);
-        yield();
-      }
-     #endif
     }
 
   private:
@@ -150,6 +96,41 @@ class SH1106Spi : public OLEDDisplay {
       SPI.transfer(com);
       set_CS(HIGH);
     }
+
+    // Sends a run of data bytes, in one bulk transfer where the SPI library has one
+    inline void sendData(const uint8_t *data, uint16_t length) __attribute__((always_inline)){
+#if defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_ESP32)
+      SPI.writeBytes(data, length);
+#else
+      while (length--) {
+        SPI.transfer(*data++);
+      }
+#endif
+    }
+
+    // The SH1106 has no scroll engine
+    bool supportsScrollEngine(void) {
+      return false;
+    }
+
+    bool supportsRegionRows(void) {
+      return true;
+    }
+
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      // Calculate the colum offset
+      uint8_t minBoundXp2H = (rect.x0 + 2) & 0x0F;
+      uint8_t minBoundXp2L = 0x10 | ((rect.x0 + 2) >> 4 );
+
+      sendCommand(0xB0 + ramPage(page));
+      sendCommand(minBoundXp2H);
+      sendCommand(minBoundXp2L);
+      set_CS(HIGH);
+      digitalWrite(_dc, HIGH);   // data mode
+      set_CS(LOW);
+      sendData(data, rect.x1 - rect.x0 + 1);
+      set_CS(HIGH);
+    }
 };
 
 #endif
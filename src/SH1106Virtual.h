@@ -0,0 +1,102 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef SH1106Virtual_h
+#define SH1106Virtual_h
+
+#include "SSD1306Virtual.h"
+
+/*
+ * In-memory SH1106, see SSD1306Virtual. The SH1106 has 132 columns of display
+ * RAM, of which columns 2..129 are visible, and only knows page addressing.
+ */
+class SH1106Virtual : public SSD1306Virtual {
+  public:
+    SH1106Virtual(OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64, uint16_t width = 0, uint16_t height = 0)
+      : SSD1306Virtual(g, width, height) {
+      this->_columns = VIRTUAL_GDDRAM_COLUMNS;
+      resetController();
+    }
+
+    void display(void) {
+      memset(&_frameStats, 0, sizeof(_frameStats));
+      uint8_t rects = getDirtyRects();
+      for (uint8_t r = 0; r < rects; r++) {
+        const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+        for (uint8_t y = rect.page0; y <= rect.page1; y++) {
+          sendRegionRow(rect, y, &buffer[rect.x0 + y * displayWidth]);
+        }
+      }
+    }
+
+  protected:
+    uint8_t getColumnOffset(void) const {
+      return 2;
+    }
+
+    bool supportsScrollEngine(void) {
+      return false;
+    }
+
+    // Like SH1106Wire every page is addressed on its own
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      // Calculate the colum offset
+      uint8_t minBoundXp2H = (rect.x0 + 2) & 0x0F;
+      uint8_t minBoundXp2L = 0x10 | ((rect.x0 + 2) >> 4 );
+
+      const uint8_t commands[] = { (uint8_t) (0xB0 + ramPage(page)), minBoundXp2H, minBoundXp2L };
+      sendCommands(commands, sizeof(commands));
+      sendData(data, rect.x1 - rect.x0 + 1);
+    }
+
+    uint8_t getArgumentCount(uint8_t com) {
+      switch (com) {
+        case SETCONTRAST:
+        case 0xAD:      // DC-DC (charge pump) mode
+        case SETMULTIPLEX:
+        case SETDISPLAYOFFSET:
+        case SETDISPLAYCLOCKDIV:
+        case SETPRECHARGE:
+        case SETCOMPINS:
+        case SETVCOMDETECT:
+          return 1;
+      }
+      return 0;
+    }
+
+    void executeCommand(uint8_t com) {
+      // There is no horizontal/vertical addressing or scrolling on the SH1106
+      if (com >= 0x20 && com <= 0x3F) return;
+      SSD1306Virtual::executeCommand(com);
+    }
+};
+
+#endif
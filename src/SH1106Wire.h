@@ -34,11 +34,19 @@
 #include "OLEDDisplay.h"
 #include <Wire.h>
 
+// Default for the data bytes per I2C transmission. With the control byte it
+// has to fit the transmit buffer of the core's Wire library, see setI2cTransferSize()
+#ifndef I2C_OLED_TRANSFER_BYTE
 #if defined(ARDUINO_ARCH_ESP32)
 #define I2C_OLED_TRANSFER_BYTE 64 /** ESP32 can Transfer Max 128 bytes */
+#elif defined(I2C_BUFFER_LENGTH)
+#define I2C_OLED_TRANSFER_BYTE (I2C_BUFFER_LENGTH - 1)
+#elif defined(BUFFER_LENGTH)
+#define I2C_OLED_TRANSFER_BYTE (BUFFER_LENGTH - 1)
 #else
 #define I2C_OLED_TRANSFER_BYTE 16
 #endif
+#endif
 
 #define SH1106_SET_PUMP_VOLTAGE 0X30
 #define SH1106_SET_PUMP_MODE 0XAD
@@ -54,6 +62,8 @@ class SH1106Wire : public OLEDDisplay {
       bool                _doI2cAutoInit = false;
       TwoWire*            _wire = NULL;
       long                _frequency;
+      uint16_t            _transferSize = I2C_OLED_TRANSFER_BYTE + 1;
+      OLEDDisplayBusStats _busStats = {};
 
   public:
     /**
@@ -102,89 +112,44 @@ class SH1106Wire : public OLEDDisplay {
 
     void display(void) {
       initI2cIfNeccesary();
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = UINT8_MAX;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = UINT8_MAX;
-        uint8_t maxBoundX = 0;
-
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (displayHeight / 8); y++) {
-          for (x = 0; x < displayWidth; x++) {
-           uint16_t pos = x + y * displayWidth;
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = _min(minBoundY, y);
-             maxBoundY = _max(maxBoundY, y);
-             minBoundX = _min(minBoundX, x);
-             maxBoundX = _max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-        if (minBoundY == UINT8_MAX) return;
-
-        // Calculate the colum offset
-        uint8_t minBoundXp2H = (minBoundX + 2) & 0x0F;
-        uint8_t minBoundXp2L = 0x10 | ((minBoundX + 2) >> 4 );
-
-        uint8_t k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          sendCommand(0xB0 + y);
-          sendCommand(minBoundXp2H);
-          sendCommand(minBoundXp2L);
-          for (x = minBoundX; x <= maxBoundX; x++) {
-            if (k == 0) {
-              _wire->beginTransmission(_address);
-              _wire->write(0x40);
-            }
-            _wire->write(buffer[x + y * displayWidth]);
-            k++;
-            if (k == I2C_OLED_TRANSFER_BYTE)  {
-              _wire->endTransmission();
-              k = 0;
-            }
-          }
-          if (k != 0)  {
-            _wire->endTransmission();
-            k = 0;
-          }
+      uint8_t rects = getDirtyRects();
+      for (uint8_t r = 0; r < rects; r++) {
+        const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+        for (uint8_t y = rect.page0; y <= rect.page1; y++) {
+          sendRegionRow(rect, y, &buffer[rect.x0 + y * displayWidth]);
           yield();
         }
-
-        if (k != 0) {
-          _wire->endTransmission();
-        }
-      #else
-        uint8_t * p = &buffer[0];
-        for (uint8_t y=0; y<8; y++) {
-          sendCommand(0xB0+y);
-          sendCommand(0x02);
-          sendCommand(0x10);
-          for( uint8_t x=0; x<(128/I2C_OLED_TRANSFER_BYTE); x++) {
-            _wire->beginTransmission(_address);
-            _wire->write(0x40);
-            for (uint8_t k = 0; k < I2C_OLED_TRANSFER_BYTE; k++) {
-              _wire->write(*p++);
-            }
-            _wire->endTransmission();
-          }
-        }
-      #endif
+      }
     }
 
     void setI2cAutoInit(bool doI2cAutoInit) {
       _doI2cAutoInit = doI2cAutoInit;
     }
 
+    /**
+     * Set the maximum number of bytes per I2C transmission, control byte included.
+     * Larger transfers need fewer start conditions and address bytes but must fit
+     * the transmit buffer of the Wire library (I2C_BUFFER_LENGTH or BUFFER_LENGTH),
+     * larger values are reduced to it if the core defines one of these.
+     */
+    void setI2cTransferSize(uint16_t bytes) {
+#if defined(I2C_BUFFER_LENGTH)
+      if (bytes > I2C_BUFFER_LENGTH) bytes = I2C_BUFFER_LENGTH;
+#elif defined(BUFFER_LENGTH)
+      if (bytes > BUFFER_LENGTH) bytes = BUFFER_LENGTH;
+#endif
+      _transferSize = bytes > 2 ? bytes : 2;
+    }
+
+    // Bus traffic since construction or the last resetBusStats()
+    OLEDDisplayBusStats getBusStats(void) const {
+      return _busStats;
+    }
+
+    void resetBusStats(void) {
+      memset(&_busStats, 0, sizeof(_busStats));
+    }
+
   private:
 	int getBufferOffset(void) {
 		return 0;
@@ -194,6 +159,64 @@ class SH1106Wire : public OLEDDisplay {
       _wire->write(0x80);
       _wire->write(command);
       _wire->endTransmission();
+      _busStats.commandBytes++;
+      _busStats.transactions++;
+      _busStats.wireBytes += 3;
+    }
+
+    // Sends several commands in one transmission, the control byte 0x00 (Co = 0)
+    // marks all following bytes as commands
+    void sendCommands(const uint8_t *commands, uint8_t length) {
+      _wire->beginTransmission(_address);
+      _wire->write(0x00);
+      _wire->write(commands, length);
+      _wire->endTransmission();
+      _busStats.commandBytes += length;
+      _busStats.transactions++;
+      _busStats.wireBytes += length + 2;
+    }
+
+    // The SH1106 has no scroll engine
+    bool supportsScrollEngine(void) {
+      return false;
+    }
+
+    bool supportsRegionRows(void) {
+      return true;
+    }
+
+    void beginRegionRows(void) {
+      initI2cIfNeccesary();
+    }
+
+    // SH1106 has no COLUMNADDR/PAGEADDR, every page is addressed on its own
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+
+      // Calculate the colum offset
+      uint8_t minBoundXp2H = (rect.x0 + 2) & 0x0F;
+      uint8_t minBoundXp2L = 0x10 | ((rect.x0 + 2) >> 4 );
+
+      const uint8_t commands[] = { (uint8_t) (0xB0 + ramPage(page)), minBoundXp2H, minBoundXp2L };
+      sendCommands(commands, sizeof(commands));
+
+      uint16_t length = rect.x1 - rect.x0 + 1;
+      while (length > 0) {
+        uint16_t k = length < _transferSize - 1 ? length : _transferSize - 1;
+        _wire->beginTransmission(_address);
+        _wire->write(0x40);
+        _wire->write(data, k);
+        endDataTransmission(k);
+        data += k;
+        length -= k;
+      }
+    }
+
+    // Ends a data transmission with the given number of data bytes
+    void endDataTransmission(uint16_t length) {
+      _wire->endTransmission();
+      _busStats.dataBytes += length;
+      _busStats.transactions++;
+      _busStats.wireBytes += length + 2;
     }
 
     void initI2cIfNeccesary() {
@@ -63,93 +63,40 @@ class SSD1306Brzo : public OLEDDisplay {
     void display(void) {
       const int x_offset = (128 - this->width()) / 2;
 
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (this->height() / 8); y++) {
-         for (x = 0; x < this->width(); x++) {
-          uint16_t pos = x + y * this->width();
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
-
-       sendCommand(COLUMNADDR);
-       sendCommand(x_offset + minBoundX);
-       sendCommand(x_offset + maxBoundX);
-
-       sendCommand(PAGEADDR);
-       sendCommand(minBoundY);
-       sendCommand(maxBoundY);
-
-       uint8_t k = 0;
-
        int buflen = ( this->width() / 8 ) + 1;
 
        uint8_t sendBuffer[buflen];
        sendBuffer[0] = 0x40;
-       brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
-       for (y = minBoundY; y <= maxBoundY; y++) {
-           for (x = minBoundX; x <= maxBoundX; x++) {
-               k++;
-               sendBuffer[k] = buffer[x + y * this->width()];
-               if (k == (buflen-1))  {
-                 brzo_i2c_write(sendBuffer, buflen, true);
-                 k = 0;
-               }
-           }
-           yield();
-       }
-       brzo_i2c_write(sendBuffer, k + 1, true);
-       brzo_i2c_end_transaction();
-     #else
-       // No double buffering
-       sendCommand(COLUMNADDR);
-
-       sendCommand(x_offset);
-       sendCommand(x_offset + (this->width() - 1));
-
-       sendCommand(PAGEADDR);
-       sendCommand(0x0);
-       sendCommand((this->height() / 8) - 1);
-
-       int buflen = ( this->width() / 8 ) + 1;
-
-       uint8_t sendBuffer[buflen];
-       sendBuffer[0] = 0x40;
-
-       brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
 
-       for (uint16_t i=0; i<displayBufferSize; i++) {
-         for (uint8_t x=1; x<buflen; x++) {
-           sendBuffer[x] = buffer[i];
-           i++;
+       uint8_t rects = getDirtyRects();
+       for (uint8_t r = 0; r < rects; r++) {
+         const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+         uint8_t x, y;
+
+         sendCommand(COLUMNADDR);
+         sendCommand(x_offset + rect.x0);
+         sendCommand(x_offset + rect.x1);
+
+         sendCommand(PAGEADDR);
+         sendCommand(ramPage(rect.page0));
+         sendCommand(ramPage(rect.page1));
+
+         uint8_t k = 0;
+         brzo_i2c_start_transaction(this->_address, BRZO_I2C_SPEED);
+         for (y = rect.page0; y <= rect.page1; y++) {
+             for (x = rect.x0; x <= rect.x1; x++) {
+                 k++;
+                 sendBuffer[k] = buffer[x + y * this->width()];
+                 if (k == (buflen-1))  {
+                   brzo_i2c_write(sendBuffer, buflen, true);
+                   k = 0;
+                 }
+             }
+             yield();
          }
-         i--;
-         brzo_i2c_write(sendBuffer,  buflen,  true);
-         yield();
+         brzo_i2c_write(sendBuffer, k + 1, true);
+         brzo_i2c_end_transaction();
        }
-       brzo_i2c_end_transaction();
-     #endif
     }
 
   private:
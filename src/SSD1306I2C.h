@@ -63,70 +63,35 @@ public:
 
     void display(void) {
       const int x_offset = (128 - this->width()) / 2;
-#ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = UINT8_MAX;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = UINT8_MAX;
-        uint8_t maxBoundX = 0;
-        uint8_t x, y;
-
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (this->height() / 8); y++) {
-          for (x = 0; x < this->width(); x++) {
-           uint16_t pos = x + y * this->width();
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = std::min(minBoundY, y);
-             maxBoundY = std::max(maxBoundY, y);
-             minBoundX = std::min(minBoundX, x);
-             maxBoundX = std::max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-
-        if (minBoundY == UINT8_MAX) return;
+      uint8_t rects = getDirtyRects();
+      for (uint8_t r = 0; r < rects; r++) {
+        const OLEDDisplayDirtyRect &rect = dirtyRects[r];
 
         sendCommand(COLUMNADDR);
-        sendCommand(x_offset + minBoundX);	// column start address (0 = reset)
-        sendCommand(x_offset + maxBoundX);	// column end address (127 = reset)
+        sendCommand(x_offset + rect.x0);	// column start address (0 = reset)
+        sendCommand(x_offset + rect.x1);	// column end address (127 = reset)
 
         sendCommand(PAGEADDR);
-        sendCommand(minBoundY);				// page start address
-        sendCommand(maxBoundY);				// page end address
+        sendCommand(ramPage(rect.page0));			// page start address
+        sendCommand(ramPage(rect.page1));			// page end address
+
+        // Full width regions are contiguous in the buffer and sent at once
+        uint16_t rowLength = (rect.x1 - rect.x0) + 1;
+        uint8_t rows = rect.page1 - rect.page0 + 1;
+        if (rowLength == this->width()) {
+          rowLength *= rows;
+          rows = 1;
+        }
 
-        for (y = minBoundY; y <= maxBoundY; y++) {
-			uint8_t *start = &buffer[(minBoundX + y * this->width())-1];
+        for (uint8_t y = rect.page0; y < rect.page0 + rows; y++) {
+			uint8_t *start = &buffer[(rect.x0 + y * this->width())-1];
 			uint8_t save = *start;
 			
 			*start = 0x40; // control
-			_i2c->write(_address, (char *)start, (maxBoundX-minBoundX) + 1 + 1);
+			_i2c->write(_address, (char *)start, rowLength + 1);
 			*start = save;
 		}
-#else
-
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset);						// column start address (0 = reset)
-        sendCommand(x_offset + (this->width() - 1));// column end address (127 = reset)
-
-        sendCommand(PAGEADDR);
-        sendCommand(0x0);							// page start address (0 = reset)
-
-        if (geometry == GEOMETRY_128_64) {
-          sendCommand(0x7);
-        } else if (geometry == GEOMETRY_128_32) {
-          sendCommand(0x3);
-        }
-
-		buffer[-1] = 0x40; // control
-		_i2c->write(_address, (char *)&buffer[-1], displayBufferSize + 1);
-#endif
+      }
     }
 
 private:
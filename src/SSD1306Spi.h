@@ -76,78 +76,33 @@ class SSD1306Spi : public OLEDDisplay {
     }
 
     void display(void) {
-    #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-       uint8_t minBoundY = UINT8_MAX;
-       uint8_t maxBoundY = 0;
-
-       uint8_t minBoundX = UINT8_MAX;
-       uint8_t maxBoundX = 0;
-
-       uint8_t x, y;
-
-       // Calculate the Y bounding box of changes
-       // and copy buffer[pos] to buffer_back[pos];
-       for (y = 0; y < (displayHeight / 8); y++) {
-         for (x = 0; x < displayWidth; x++) {
-          uint16_t pos = x + y * displayWidth;
-          if (buffer[pos] != buffer_back[pos]) {
-            minBoundY = _min(minBoundY, y);
-            maxBoundY = _max(maxBoundY, y);
-            minBoundX = _min(minBoundX, x);
-            maxBoundX = _max(maxBoundX, x);
-          }
-          buffer_back[pos] = buffer[pos];
-        }
-        yield();
-       }
-
-       // If the minBoundY wasn't updated
-       // we can savely assume that buffer_back[pos] == buffer[pos]
-       // holdes true for all values of pos
-       if (minBoundY == UINT8_MAX) return;
-
-       sendCommand(COLUMNADDR);
-       sendCommand(minBoundX);
-       sendCommand(maxBoundX);
-
-       sendCommand(PAGEADDR);
-       sendCommand(minBoundY);
-       sendCommand(maxBoundY);
-
-       set_CS(HIGH);
-       digitalWrite(_dc, HIGH);   // data mode
-       set_CS(LOW);
-       for (y = minBoundY; y <= maxBoundY; y++) {
-         for (x = minBoundX; x <= maxBoundX; x++) {
-           SPI.transfer(buffer[x + y * displayWidth]);
+       uint8_t rects = getDirtyRects();
+       for (uint8_t r = 0; r < rects; r++) {
+         const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+         uint8_t y;
+
+         sendCommand(COLUMNADDR);
+         sendCommand(rect.x0);
+         sendCommand(rect.x1);
+
+         sendCommand(PAGEADDR);
+         sendCommand(ramPage(rect.page0));
+         sendCommand(ramPage(rect.page1));
+
+         set_CS(HIGH);
+         digitalWrite(_dc, HIGH);   // data mode
+         set_CS(LOW);
+         if (rect.x1 - rect.x0 + 1 == displayWidth) {
+           // Full width regions are contiguous in the buffer
+           sendData(&buffer[rect.page0 * displayWidth], (rect.page1 - rect.page0 + 1) * displayWidth);
+         } else {
+           for (y = rect.page0; y <= rect.page1; y++) {
+             sendData(&buffer[rect.x0 + y * displayWidth], rect.x1 - rect.x0 + 1);
+             yield();
+           }
          }
-         yield();
-       }
-       set_CS(HIGH);
-     #else
-       // No double buffering
-       sendCommand(COLUMNADDR);
-       sendCommand(0x0);
-       sendCommand(0x7F);
-
-       sendCommand(PAGEADDR);
-       sendCommand(0x0);
-
-       if (geometry == GEOMETRY_128_64 || geometry == GEOMETRY_64_48 || geometry == GEOMETRY_64_32 ) {
-         sendCommand(0x7);
-       } else if (geometry == GEOMETRY_128_32) {
-         sendCommand(0x3);
+         set_CS(HIGH);
        }
-
-        set_CS(HIGH);
-        digitalWrite(_dc, HIGH);   // data mode
-        set_CS(LOW);
-        for (uint16_t i=0; i<displayBufferSize; i++) {
-          SPI.transfer(buffer[i]);
-          yield();
-        }
-        set_CS(HIGH);
-     #endif
     }
 
   private:
@@ -166,6 +121,39 @@ class SSD1306Spi : public OLEDDisplay {
       SPI.transfer(com);
       set_CS(HIGH);
     }
+
+    // Sends a run of data bytes, in one bulk transfer where the SPI library has one
+    inline void sendData(const uint8_t *data, uint16_t length) __attribute__((always_inline)){
+#if defined(ARDUINO_ARCH_ESP8266) || defined(ARDUINO_ARCH_ESP32)
+      SPI.writeBytes(data, length);
+#else
+      while (length--) {
+        SPI.transfer(*data++);
+      }
+#endif
+    }
+
+    bool supportsRegionRows(void) {
+      return true;
+    }
+
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      if (page == rect.page0) {
+        sendCommand(COLUMNADDR);
+        sendCommand(rect.x0);
+        sendCommand(rect.x1);
+
+        sendCommand(PAGEADDR);
+        sendCommand(ramPage(rect.page0));
+        sendCommand(ramPage(rect.page1));
+      }
+
+      set_CS(HIGH);
+      digitalWrite(_dc, HIGH);   // data mode
+      set_CS(LOW);
+      sendData(data, rect.x1 - rect.x0 + 1);
+      set_CS(HIGH);
+    }
 };
 
 #endif
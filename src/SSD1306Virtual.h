@@ -0,0 +1,452 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+#ifndef SSD1306Virtual_h
+#define SSD1306Virtual_h
+
+#include "OLEDDisplay.h"
+
+/*
+ * An in-memory SSD1306 that needs no hardware at all. Commands and data sent by
+ * display() are parsed the way the controller would (COLUMNADDR, PAGEADDR,
+ * 0xB0 page and 0x00/0x10 column commands, addressing modes) and written into
+ * an emulated GDDRAM. The scroll engine is emulated as well, with no clock it
+ * makes the steps advanceScroll() asks for. Every byte is counted and grouped into transactions the
+ * way SSD1306Wire and SH1106Wire send them, so the bus cost of a screen can be measured and the panel
+ * content can be compared bit for bit against the framebuffer.
+ */
+
+#define VIRTUAL_GDDRAM_COLUMNS 132  // SH1106 has 132 columns, SSD1306 uses the first 128
+#define VIRTUAL_GDDRAM_PAGES 8
+
+#ifndef VIRTUAL_TRANSFER_BYTE
+#define VIRTUAL_TRANSFER_BYTE 16     /** Data bytes per transaction, like SSD1306Wire on ESP8266 */
+#endif
+
+class SSD1306Virtual : public OLEDDisplay {
+  protected:
+      uint8_t             _gddram[VIRTUAL_GDDRAM_PAGES][VIRTUAL_GDDRAM_COLUMNS];
+      uint8_t             _columns;          // Columns the controller addresses
+      uint16_t            _transferSize;
+      uint16_t            _openData;         // Data bytes in the current transaction
+
+      // Controller state
+      uint8_t             _addressingMode;   // 0 horizontal, 1 vertical, 2 page
+      uint8_t             _column, _columnStart, _columnEnd;
+      uint8_t             _page, _pageStart, _pageEnd;
+      uint8_t             _startLine;
+      bool                _displayOn;
+
+      // Scroll engine
+      bool                _scrolling;
+      uint8_t             _scrollCommand;
+      uint8_t             _scrollPageStart, _scrollPageEnd;
+      uint8_t             _scrollRowsPerStep;
+      uint8_t             _scrollTop, _scrollRows;   // Vertical scroll area
+      uint8_t             _scrollOffset;             // Rows the area moved up
+
+      // Command parser state
+      uint8_t             _command;
+      uint8_t             _args[6];
+      uint8_t             _argCount;
+      uint8_t             _argsExpected;
+
+      OLEDDisplayBusStats _frameStats;
+      OLEDDisplayBusStats _totalStats;
+
+  public:
+    /**
+     * Create an emulated display
+     *
+     * @param g display geometry, see OLEDDISPLAY_GEOMETRY definition for options
+     * @param width width in pixel, only used with GEOMETRY_RAWMODE
+     * @param height height in pixel, only used with GEOMETRY_RAWMODE
+     */
+    SSD1306Virtual(OLEDDISPLAY_GEOMETRY g = GEOMETRY_128_64, uint16_t width = 0, uint16_t height = 0) {
+      setGeometry(g, width, height);
+
+      this->_columns = 128;
+      this->_transferSize = VIRTUAL_TRANSFER_BYTE;
+      this->_openData = 0;
+      resetController();
+      resetStats();
+    }
+
+    bool connect() {
+      resetController();
+      return true;
+    }
+
+    void display(void) {
+      const int x_offset = (128 - this->width()) / 2;
+      memset(&_frameStats, 0, sizeof(_frameStats));
+      uint8_t rects = getDirtyRects();
+      for (uint8_t r = 0; r < rects; r++) {
+        const OLEDDisplayDirtyRect &rect = dirtyRects[r];
+        uint8_t y;
+
+        const uint8_t commands[] = {
+          COLUMNADDR, (uint8_t) (x_offset + rect.x0), (uint8_t) (x_offset + rect.x1),
+          PAGEADDR, ramPage(rect.page0), ramPage(rect.page1)
+        };
+        sendCommands(commands, sizeof(commands));
+
+        for (y = rect.page0; y <= rect.page1; y++) {
+          sendData(&buffer[rect.x0 + y * this->width()], rect.x1 - rect.x0 + 1);
+        }
+      }
+    }
+
+    // Number of data bytes sent per emulated bus transaction
+    void setTransferSize(uint16_t bytes) {
+      this->_transferSize = bytes > 0 ? bytes : 1;
+    }
+
+    // Bus traffic caused by the last call to display()
+    OLEDDisplayBusStats getFrameStats(void) const {
+      return _frameStats;
+    }
+
+    // Bus traffic since construction or the last resetStats()
+    OLEDDisplayBusStats getTotalStats(void) const {
+      return _totalStats;
+    }
+
+    void resetStats(void) {
+      memset(&_frameStats, 0, sizeof(_frameStats));
+      memset(&_totalStats, 0, sizeof(_totalStats));
+    }
+
+    // Content of the emulated display RAM
+    uint8_t getGDDRAM(uint8_t column, uint8_t page) const {
+      if (column >= VIRTUAL_GDDRAM_COLUMNS || page >= VIRTUAL_GDDRAM_PAGES) return 0;
+      return _gddram[page][column];
+    }
+
+    bool isDisplayOn(void) const {
+      return _displayOn;
+    }
+
+    uint8_t getStartLine(void) const {
+      return _startLine;
+    }
+
+    bool isScrollEngineOn(void) const {
+      return _scrolling;
+    }
+
+    // Makes steps steps of the running scroll engine: columns of the scrolled
+    // pages rotate through all 128 columns of the display RAM, the vertical
+    // scroll area moves up
+    void advanceScroll(uint32_t steps) {
+      if (!_scrolling) return;
+      const uint8_t columns = steps % 128;
+      if (columns) {
+        uint8_t row[128];
+        const bool left = _scrollCommand == LEFT_HORIZONTAL_SCROLL || _scrollCommand == VERTICAL_AND_LEFT_HORIZONTAL_SCROLL;
+        for (uint8_t page = _scrollPageStart; page <= _scrollPageEnd; page++) {
+          memcpy(row, _gddram[page], 128);
+          for (uint8_t c = 0; c < 128; c++) {
+            _gddram[page][c] = row[(c + (left ? columns : 128 - columns)) & 127];
+          }
+        }
+      }
+      if (_scrollRowsPerStep && _scrollRows) {
+        _scrollOffset = (_scrollOffset + (uint64_t) steps * _scrollRowsPerStep) % _scrollRows;
+      }
+    }
+
+    // Returns true if the visible part of the emulated display RAM is identical
+    // to the local framebuffer, i.e. everything drawn has reached the panel.
+    // Row y of the panel shows row y + start line of the display RAM.
+    bool matchesBuffer(void) const {
+      if (_scrollOffset) {
+        return matchesBufferScrolled();
+      }
+      const uint8_t x_offset = getColumnOffset();
+      const uint16_t pages = std::min<uint16_t>(this->height() / 8, VIRTUAL_GDDRAM_PAGES);
+      const uint16_t columns = std::min<uint16_t>(this->width(), VIRTUAL_GDDRAM_COLUMNS - x_offset);
+      const uint8_t shift = _startLine & 7;
+      for (uint16_t y = 0; y < pages; y++) {
+        const uint8_t *upper = &_gddram[(y + (_startLine >> 3)) % VIRTUAL_GDDRAM_PAGES][x_offset];
+        const uint8_t *lower = &_gddram[(y + (_startLine >> 3) + 1) % VIRTUAL_GDDRAM_PAGES][x_offset];
+        if (!shift) {
+          if (memcmp(upper, &buffer[y * this->width()], columns) != 0) {
+            return false;
+          }
+          continue;
+        }
+        for (uint16_t x = 0; x < columns; x++) {
+          if ((uint8_t) ((upper[x] >> shift) | (lower[x] << (8 - shift))) != buffer[y * this->width() + x]) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+  protected:
+	int getBufferOffset(void) {
+		return 0;
+	}
+
+    // matchesBuffer() a pixel at a time while the vertical scroll area is moved
+    bool matchesBufferScrolled(void) const {
+      const uint8_t x_offset = getColumnOffset();
+      const uint16_t rows = std::min<uint16_t>(this->height(), VIRTUAL_GDDRAM_PAGES * 8);
+      const uint16_t columns = std::min<uint16_t>(this->width(), VIRTUAL_GDDRAM_COLUMNS - x_offset);
+      for (uint16_t y = 0; y < rows; y++) {
+        uint16_t line = y;
+        if (y >= _scrollTop && y < _scrollTop + _scrollRows) {
+          line = _scrollTop + (y - _scrollTop + _scrollOffset) % _scrollRows;
+        }
+        line = (line + _startLine) % (VIRTUAL_GDDRAM_PAGES * 8);
+        for (uint16_t x = 0; x < columns; x++) {
+          bool shown = _gddram[line / 8][x_offset + x] & (1 << (line & 7));
+          bool drawn = buffer[(y / 8) * this->width() + x] & (1 << (y & 7));
+          if (shown != drawn) {
+            return false;
+          }
+        }
+      }
+      return true;
+    }
+
+    // Column of the display RAM that shows x = 0
+    virtual uint8_t getColumnOffset(void) const {
+      return (128 - this->width()) / 2;
+    }
+
+    bool supportsRegionRows(void) {
+      return true;
+    }
+
+    // Like SSD1306Wire, asynchronous transfers send every page of a region in
+    // transactions of its own
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      if (page == rect.page0) {
+        const int x_offset = (128 - this->width()) / 2;
+        const uint8_t commands[] = {
+          COLUMNADDR, (uint8_t) (x_offset + rect.x0), (uint8_t) (x_offset + rect.x1),
+          PAGEADDR, ramPage(rect.page0), ramPage(rect.page1)
+        };
+        sendCommands(commands, sizeof(commands));
+      }
+      sendData(data, rect.x1 - rect.x0 + 1);
+      _openData = 0;
+    }
+
+    void countTraffic(uint32_t commandBytes, uint32_t dataBytes, uint32_t transactions, uint32_t wireBytes) {
+      _frameStats.commandBytes += commandBytes;
+      _frameStats.dataBytes += dataBytes;
+      _frameStats.transactions += transactions;
+      _frameStats.wireBytes += wireBytes;
+      _totalStats.commandBytes += commandBytes;
+      _totalStats.dataBytes += dataBytes;
+      _totalStats.transactions += transactions;
+      _totalStats.wireBytes += wireBytes;
+    }
+
+    // Single command: address, control byte 0x80 and the command
+    void sendCommand(uint8_t com) {
+      _openData = 0;
+      countTraffic(1, 0, 1, 3);
+      parseCommand(com);
+    }
+
+    // Batch of commands: address, control byte 0x00 and the commands
+    void sendCommands(const uint8_t *commands, uint8_t length) {
+      _openData = 0;
+      countTraffic(length, 0, 1, length + 2);
+      while (length--) {
+        parseCommand(*commands++);
+      }
+    }
+
+    // Data continues the open transaction until it holds _transferSize bytes,
+    // like the Wire drivers fill their transmissions. Commands close it.
+    void sendData(const uint8_t *data, uint16_t length) {
+      uint32_t transactions = 0;
+      for (uint16_t i = 0; i < length; i++) {
+        if (_openData == 0) transactions++;
+        if (++_openData == _transferSize) _openData = 0;
+        writeData(data[i]);
+      }
+      // Every transaction starts with the address and the control byte 0x40
+      countTraffic(0, length, transactions, length + 2 * transactions);
+    }
+
+    void resetController(void) {
+      memset(_gddram, 0, sizeof(_gddram));
+      _addressingMode = 2;
+      _column = _columnStart = 0;
+      _columnEnd = _columns - 1;
+      _page = _pageStart = 0;
+      _pageEnd = VIRTUAL_GDDRAM_PAGES - 1;
+      _startLine = 0;
+      _displayOn = false;
+      _scrolling = false;
+      _scrollCommand = RIGHT_HORIZONTAL_SCROLL;
+      _scrollPageStart = _scrollPageEnd = 0;
+      _scrollRowsPerStep = 0;
+      _scrollTop = 0;
+      _scrollRows = VIRTUAL_GDDRAM_PAGES * 8;
+      _scrollOffset = 0;
+      _argCount = 0;
+      _argsExpected = 0;
+    }
+
+    // Number of parameter bytes following a command byte
+    virtual uint8_t getArgumentCount(uint8_t com) {
+      switch (com) {
+        case SETCONTRAST:
+        case CHARGEPUMP:
+        case MEMORYMODE:
+        case SETMULTIPLEX:
+        case SETDISPLAYOFFSET:
+        case SETDISPLAYCLOCKDIV:
+        case SETPRECHARGE:
+        case SETCOMPINS:
+        case SETVCOMDETECT:
+          return 1;
+        case COLUMNADDR:
+        case PAGEADDR:
+        case SET_VERTICAL_SCROLL_AREA:
+          return 2;
+        case VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL:
+        case VERTICAL_AND_LEFT_HORIZONTAL_SCROLL:
+          return 5;
+        case RIGHT_HORIZONTAL_SCROLL:
+        case LEFT_HORIZONTAL_SCROLL:
+          return 6;
+      }
+      return 0;
+    }
+
+    void parseCommand(uint8_t com) {
+      if (_argsExpected) {
+        _args[_argCount++] = com;
+        if (_argCount == _argsExpected) {
+          _argsExpected = 0;
+          executeCommand(_command);
+        }
+        return;
+      }
+
+      _command = com;
+      _argCount = 0;
+      _argsExpected = getArgumentCount(com);
+      if (!_argsExpected) {
+        executeCommand(com);
+      }
+    }
+
+    virtual void executeCommand(uint8_t com) {
+      if (com <= 0x0F) {                  // lower column nibble, page addressing
+        _column = (_column & 0xF0) | com;
+      } else if (com <= 0x1F) {           // upper column nibble, page addressing
+        _column = ((com & 0x0F) << 4) | (_column & 0x0F);
+      } else if (com >= SETSTARTLINE && com <= SETSTARTLINE + 63) {
+        _startLine = com - SETSTARTLINE;
+      } else if (com >= 0xB0 && com <= 0xB7) {
+        _page = com - 0xB0;
+      } else {
+        switch (com) {
+          case MEMORYMODE:
+            _addressingMode = _args[0] & 0x03;
+            break;
+          case COLUMNADDR:
+            _columnStart = _column = _args[0] % _columns;
+            _columnEnd = _args[1] % _columns;
+            break;
+          case PAGEADDR:
+            _pageStart = _page = _args[0] & 0x07;
+            _pageEnd = _args[1] & 0x07;
+            break;
+          case DISPLAYON:
+            _displayOn = true;
+            break;
+          case DISPLAYOFF:
+            _displayOn = false;
+            break;
+          case RIGHT_HORIZONTAL_SCROLL:
+          case LEFT_HORIZONTAL_SCROLL:
+          case VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL:
+          case VERTICAL_AND_LEFT_HORIZONTAL_SCROLL:
+            _scrollCommand = com;
+            _scrollPageStart = _args[1] & 0x07;
+            _scrollPageEnd = _args[3] & 0x07;
+            _scrollRowsPerStep = com >= VERTICAL_AND_RIGHT_HORIZONTAL_SCROLL ? _args[4] & 0x3F : 0;
+            break;
+          case SET_VERTICAL_SCROLL_AREA:
+            _scrollTop = _args[0] & 0x3F;
+            _scrollRows = _args[1] & 0x7F;
+            break;
+          case ACTIVATE_SCROLL:
+            _scrolling = true;
+            _scrollOffset = 0;
+            break;
+          case DEACTIVATE_SCROLL:
+            // The rows are shown where they are in the display RAM again, the
+            // columns stay where the engine moved them
+            _scrolling = false;
+            _scrollOffset = 0;
+            break;
+        }
+      }
+    }
+
+    void writeData(uint8_t data) {
+      if (_page < VIRTUAL_GDDRAM_PAGES && _column < _columns) {
+        _gddram[_page][_column] = data;
+      }
+
+      switch (_addressingMode) {
+        case 0:   // horizontal
+          if (_column++ >= _columnEnd) {
+            _column = _columnStart;
+            _page = _page >= _pageEnd ? _pageStart : _page + 1;
+          }
+          break;
+        case 1:   // vertical
+          if (_page++ >= _pageEnd) {
+            _page = _pageStart;
+            _column = _column >= _columnEnd ? _columnStart : _column + 1;
+          }
+          break;
+        default:  // page
+          _column = (_column + 1) % _columns;
+          break;
+      }
+    }
+};
+
+#endif
@@ -39,11 +39,19 @@
 #define _min	min
 #define _max	max
 #endif
+// Default for the bytes per I2C transmission, control byte included. It has
+// to fit the transmit buffer of the core's Wire library, see setI2cTransferSize()
+#ifndef I2C_MAX_TRANSFER_BYTE
 #if defined(ARDUINO_ARCH_ESP32)
 #define I2C_MAX_TRANSFER_BYTE 128 /** ESP32 can Transfer 128 bytes */
+#elif defined(I2C_BUFFER_LENGTH)
+#define I2C_MAX_TRANSFER_BYTE I2C_BUFFER_LENGTH
+#elif defined(BUFFER_LENGTH)
+#define I2C_MAX_TRANSFER_BYTE BUFFER_LENGTH
 #else
 #define I2C_MAX_TRANSFER_BYTE 17
 #endif
+#endif
 //--------------------------------------
 
 class SSD1306Wire : public OLEDDisplay {
@@ -54,6 +62,8 @@ class SSD1306Wire : public OLEDDisplay {
       bool                _doI2cAutoInit = false;
       TwoWire*            _wire = NULL;
       long                _frequency;
+      uint16_t            _transferSize = I2C_MAX_TRANSFER_BYTE;
+      OLEDDisplayBusStats _busStats = {};
 
   public:
 
@@ -104,47 +114,20 @@ class SSD1306Wire : public OLEDDisplay {
     void display(void) {
       initI2cIfNeccesary();
       const int x_offset = (128 - this->width()) / 2;
-      #ifdef OLEDDISPLAY_DOUBLE_BUFFER
-        uint8_t minBoundY = UINT8_MAX;
-        uint8_t maxBoundY = 0;
-
-        uint8_t minBoundX = UINT8_MAX;
-        uint8_t maxBoundX = 0;
+      uint8_t rects = getDirtyRects();
+      for (uint8_t r = 0; r < rects; r++) {
+        const OLEDDisplayDirtyRect &rect = dirtyRects[r];
         uint8_t x, y;
 
-        // Calculate the Y bounding box of changes
-        // and copy buffer[pos] to buffer_back[pos];
-        for (y = 0; y < (this->height() / 8); y++) {
-          for (x = 0; x < this->width(); x++) {
-           uint16_t pos = x + y * this->width();
-           if (buffer[pos] != buffer_back[pos]) {
-             minBoundY = std::min(minBoundY, y);
-             maxBoundY = std::max(maxBoundY, y);
-             minBoundX = std::min(minBoundX, x);
-             maxBoundX = std::max(maxBoundX, x);
-           }
-           buffer_back[pos] = buffer[pos];
-         }
-         yield();
-        }
-
-        // If the minBoundY wasn't updated
-        // we can savely assume that buffer_back[pos] == buffer[pos]
-        // holdes true for all values of pos
-
-        if (minBoundY == UINT8_MAX) return;
+        const uint8_t commands[] = {
+          COLUMNADDR, (uint8_t) (x_offset + rect.x0), (uint8_t) (x_offset + rect.x1),
+          PAGEADDR, ramPage(rect.page0), ramPage(rect.page1)
+        };
+        sendCommands(commands, sizeof(commands));
 
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset + minBoundX);
-        sendCommand(x_offset + maxBoundX);
-
-        sendCommand(PAGEADDR);
-        sendCommand(minBoundY);
-        sendCommand(maxBoundY);
-
-        uint8_t k = 0;
-        for (y = minBoundY; y <= maxBoundY; y++) {
-          for (x = minBoundX; x <= maxBoundX; x++) {
+        uint16_t k = 0;
+        for (y = rect.page0; y <= rect.page1; y++) {
+          for (x = rect.x0; x <= rect.x1; x++) {
             if (k == 0) {
               _wire->beginTransmission(_address);
               _wire->write(0x40);
@@ -152,8 +135,8 @@ class SSD1306Wire : public OLEDDisplay {
 
             _wire->write(buffer[x + y * this->width()]);
             k++;
-            if (k == (I2C_MAX_TRANSFER_BYTE - 1))  {
-              _wire->endTransmission();
+            if (k == (_transferSize - 1))  {
+              endDataTransmission(k);
               k = 0;
             }
           }
@@ -161,32 +144,37 @@ class SSD1306Wire : public OLEDDisplay {
         }
 
         if (k != 0) {
-          _wire->endTransmission();
+          endDataTransmission(k);
         }
-      #else
+      }
+    }
 
-        sendCommand(COLUMNADDR);
-        sendCommand(x_offset);
-        sendCommand(x_offset + (this->width() - 1));
+    void setI2cAutoInit(bool doI2cAutoInit) {
+      _doI2cAutoInit = doI2cAutoInit;
+    }
 
-        sendCommand(PAGEADDR);
-        sendCommand(0x0);
+    /**
+     * Set the maximum number of bytes per I2C transmission, control byte included.
+     * Larger transfers need fewer start conditions and address bytes but must fit
+     * the transmit buffer of the Wire library (I2C_BUFFER_LENGTH or BUFFER_LENGTH),
+     * larger values are reduced to it if the core defines one of these.
+     */
+    void setI2cTransferSize(uint16_t bytes) {
+#if defined(I2C_BUFFER_LENGTH)
+      if (bytes > I2C_BUFFER_LENGTH) bytes = I2C_BUFFER_LENGTH;
+#elif defined(BUFFER_LENGTH)
+      if (bytes > BUFFER_LENGTH) bytes = BUFFER_LENGTH;
+#endif
+      _transferSize = bytes > 2 ? bytes : 2;
+    }
 
-        for (uint16_t i=0; i < displayBufferSize; i++) {
-          _wire->beginTransmission(this->_address);
-          _wire->write(0x40);
-          for (uint8_t x = 0; x < (I2C_MAX_TRANSFER_BYTE - 1); x++) {
-            _wire->write(buffer[i]);
-            i++;
-          }
-          i--;
-          _wire->endTransmission();
-        }
-      #endif
+    // Bus traffic since construction or the last resetBusStats()
+    OLEDDisplayBusStats getBusStats(void) const {
+      return _busStats;
     }
 
-    void setI2cAutoInit(bool doI2cAutoInit) {
-      _doI2cAutoInit = doI2cAutoInit;
+    void resetBusStats(void) {
+      memset(&_busStats, 0, sizeof(_busStats));
     }
 
   private:
@@ -199,6 +187,59 @@ class SSD1306Wire : public OLEDDisplay {
       _wire->write(0x80);
       _wire->write(command);
       _wire->endTransmission();
+      _busStats.commandBytes++;
+      _busStats.transactions++;
+      _busStats.wireBytes += 3;
+    }
+
+    // Sends several commands in one transmission, the control byte 0x00 (Co = 0)
+    // marks all following bytes as commands
+    void sendCommands(const uint8_t *commands, uint8_t length) {
+      _wire->beginTransmission(_address);
+      _wire->write(0x00);
+      _wire->write(commands, length);
+      _wire->endTransmission();
+      _busStats.commandBytes += length;
+      _busStats.transactions++;
+      _busStats.wireBytes += length + 2;
+    }
+
+    bool supportsRegionRows(void) {
+      return true;
+    }
+
+    void beginRegionRows(void) {
+      initI2cIfNeccesary();
+    }
+
+    void sendRegionRow(const OLEDDisplayDirtyRect &rect, uint8_t page, const uint8_t *data) {
+      if (page == rect.page0) {
+        const int x_offset = (128 - this->width()) / 2;
+        const uint8_t commands[] = {
+          COLUMNADDR, (uint8_t) (x_offset + rect.x0), (uint8_t) (x_offset + rect.x1),
+          PAGEADDR, ramPage(rect.page0), ramPage(rect.page1)
+        };
+        sendCommands(commands, sizeof(commands));
+      }
+
+      uint16_t length = rect.x1 - rect.x0 + 1;
+      while (length > 0) {
+        uint16_t k = length < _transferSize - 1 ? length : _transferSize - 1;
+        _wire->beginTransmission(_address);
+        _wire->write(0x40);
+        _wire->write(data, k);
+        endDataTransmission(k);
+        data += k;
+        length -= k;
+      }
+    }
+
+    // Ends a data transmission with the given number of data bytes
+    void endDataTransmission(uint16_t length) {
+      _wire->endTransmission();
+      _busStats.dataBytes += length;
+      _busStats.transactions++;
+      _busStats.wireBytes += length + 2;
     }
 
     void initI2cIfNeccesary() {
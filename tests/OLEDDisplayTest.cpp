@@ -0,0 +1,455 @@
+/**
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2018 by ThingPulse, Daniel Eichhorn
+ * Copyright (c) 2018 by Fabrice Weinberg
+ * Copyright (c) 2019 by Helmut Tschemernjak - www.radioshuttle.de
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * ThingPulse invests considerable time and money to develop these open source libraries.
+ * Please support us by buying our products (and not the clones) from
+ * https://thingpulse.com
+ *
+ */
+
+/*
+ * Checks that what display() sends reaches the panel. Everything is drawn
+ * through the public API onto the virtual displays, after every display() the
+ * emulated display RAM has to match the framebuffer and the bytes sent have to
+ * be what the build configuration (OLEDDISPLAY_TEST_CONFIG) promises.
+ *
+ * The CMake build compiles this once per configuration, see CMakeLists.txt.
+ *
+ * Usage: oleddisplay_test_<config> [--seed N]
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "SSD1306Virtual.h"
+#include "SH1106Virtual.h"
+#include "OLEDDisplayFixed.h"
+#include "OLEDDisplayFontsPacked.h"
+
+#ifndef OLEDDISPLAY_TEST_CONFIG
+#define OLEDDISPLAY_TEST_CONFIG "default"
+#endif
+
+#define TEST_FRAMES 300     // Frames of random drawing per display and geometry
+
+static uint32_t checks   = 0;
+static uint32_t failures = 0;
+static const char *currentCase = "";
+
+#define CHECK(condition) check((condition), #condition, __FILE__, __LINE__)
+
+static bool check(bool passed, const char *condition, const char *file, int line) {
+  checks++;
+  if (!passed) {
+    failures++;
+    // Only the first failures, a broken transfer tends to fail every frame
+    if (failures <= 20) {
+      printf("%s:%d: %s: CHECK(%s) failed\n", file, line, currentCase, condition);
+    }
+  }
+  return passed;
+}
+
+struct TestGeometry {
+  const char          *name;
+  OLEDDISPLAY_GEOMETRY geometry;
+};
+
+static const TestGeometry geometries[] = {
+  { "128x64", GEOMETRY_128_64 },
+  { "128x32", GEOMETRY_128_32 },
+  { "64x48",  GEOMETRY_64_48 },
+  { "64x32",  GEOMETRY_64_32 },
+};
+
+static const uint8_t *fonts[] = {
+  ArialMT_Plain_10, ArialMT_Plain_16, ArialMT_Plain_24,
+  ArialMT_Plain_10_Packed, ArialMT_Plain_16_Packed, ArialMT_Plain_24_Packed,
+};
+
+// 16x16 image in the internal (drawFastImage) format and as XBM
+static uint8_t image[32];
+
+static uint32_t seed = 0x12345678;
+
+static uint32_t random(uint32_t range) {
+  seed = seed * 1664525 + 1013904223;
+  return (seed >> 8) % range;
+}
+
+// Coordinate in the range of the display size, partially off screen
+static int16_t coordinate(uint16_t range) {
+  return (int16_t) random(range + range / 2) - range / 4;
+}
+
+static uint32_t fullFrameBytes(OLEDDisplay &display) {
+  return display.width() * display.height() / 8;
+}
+
+// Checks that the last display() reached the panel and sent what the
+// configuration promises. changed is false if nothing was drawn since the
+// previous display().
+static void checkFrame(SSD1306Virtual &display, bool changed) {
+  OLEDDisplayBusStats stats = display.getFrameStats();
+  CHECK(display.matchesBuffer());
+  CHECK(stats.dataBytes <= fullFrameBytes(display));
+#if defined(OLEDDISPLAY_REDUCE_MEMORY) && !defined(OLEDDISPLAY_SEGMENT_HASHES) && !defined(OLEDDISPLAY_DIRTY_TRACKING)
+  // Without a way to find the changes everything is sent
+  (void) changed;
+  CHECK(stats.dataBytes == fullFrameBytes(display));
+#else
+  if (!changed) {
+    CHECK(stats.dataBytes == 0);
+    CHECK(stats.transactions == 0);
+  }
+#endif
+}
+
+// Draws a random primitive through the public API. The random values are
+// drawn up front, the order arguments are evaluated in is unspecified.
+static void drawRandom(OLEDDisplay &display) {
+  static const OLEDDISPLAY_COLOR colors[] = { WHITE, WHITE, BLACK, INVERSE };
+  static const char *texts[] = { "Hello", "WMQ@%", "jpgy", "1:23.45", "Gr\xC3\xBC\xC3\x9F" "e", "fi|l" };
+  const uint16_t w = display.width();
+  const uint16_t h = display.height();
+  display.setColor(colors[random(4)]);
+  const uint8_t primitive = random(14);
+  const int16_t x0 = coordinate(w), y0 = coordinate(h);
+  const int16_t x1 = coordinate(w), y1 = coordinate(h);
+  const int16_t x2 = coordinate(w), y2 = coordinate(h);
+  const uint16_t size = random(w), size2 = random(h);
+  const uint8_t choice = random(6);
+
+  switch (primitive) {
+    case 0:
+      display.setPixel(x0, y0);
+      break;
+    case 1:
+      display.drawLine(x0, y0, x1, y1);
+      break;
+    case 2:
+      display.drawRect(x0, y0, size, size2);
+      break;
+    case 3:
+      display.fillRect(x0, y0, size / 2, size2 / 2);
+      break;
+    case 4:
+      display.drawCircle(x0, y0, size2 / 2);
+      break;
+    case 5:
+      display.fillCircle(x0, y0, size2 / 3);
+      break;
+    case 6:
+      display.fillTriangle(x0, y0, x1, y1, x2, y2);
+      break;
+    case 7:
+      display.drawHorizontalLine(x0, y0, size);
+      break;
+    case 8:
+      display.drawVerticalLine(x0, y0, size2);
+      break;
+    case 9:
+      display.drawProgressBar(size / 2, size2 / 2, 10 + size / 2, 6 + size2 % 10, size % 101);
+      break;
+    case 10:
+      display.drawFastImage(x0, y0, 16, 16, image);
+      break;
+    case 11:
+      display.drawXbm(x0, y0, 16, 16, image);
+      break;
+    case 12:
+      display.setFont(fonts[choice]);
+      display.setTextAlignment((OLEDDISPLAY_TEXT_ALIGNMENT) (size % 4));
+      display.drawString(x0, y0, texts[size2 % 6]);
+      break;
+    case 13:
+      display.setFont(fonts[choice]);
+      display.setTextAlignment(TEXT_ALIGN_LEFT);
+      display.drawStringMaxWidth(x0, y0, 20 + size, "The quick brown fox jumps over the lazy dog");
+      break;
+  }
+}
+
+// Random drawing, a frame at a time, sometimes starting from a clear screen
+static void testRandomDrawing(SSD1306Virtual &display) {
+  display.init();
+  display.display();
+  checkFrame(display, true);
+
+  uint32_t dataBytes = display.getTotalStats().dataBytes;
+  for (uint16_t frame = 0; frame < TEST_FRAMES; frame++) {
+    uint8_t ops = random(8);
+    bool cleared = random(16) == 0;
+    if (cleared) {
+      display.clear();
+    }
+    for (uint8_t op = 0; op < ops; op++) {
+      drawRandom(display);
+    }
+    display.display();
+    // Drawing BLACK on an empty area or INVERSE twice may change nothing, so
+    // only frames without drawing have to be free
+    checkFrame(display, cleared || ops > 0);
+    dataBytes += display.getFrameStats().dataBytes;
+  }
+  CHECK(display.getTotalStats().dataBytes == dataBytes);
+  display.end();
+}
+
+// The same with displayAsync(), sent a page at a time by poll()
+static void testAsync(SSD1306Virtual &display) {
+  display.init();
+  for (uint16_t frame = 0; frame < TEST_FRAMES / 4; frame++) {
+    for (uint8_t op = random(8); op > 0; op--) {
+      drawRandom(display);
+    }
+    CHECK(display.displayAsync());
+    while (display.poll());
+    CHECK(!display.isBusy());
+    CHECK(display.matchesBuffer());
+  }
+  display.end();
+}
+
+// A changed pixel costs the smallest unit the configuration can find
+static void testByteCounts(SSD1306Virtual &display) {
+  display.init();
+  display.display();
+
+  display.setPixel(10, 10);
+  display.display();
+  checkFrame(display, true);
+  uint32_t dataBytes = display.getFrameStats().dataBytes;
+  (void) dataBytes;
+#if defined(OLEDDISPLAY_DIRTY_TRACKING)
+  CHECK(dataBytes == 1);
+#elif defined(OLEDDISPLAY_DOUBLE_BUFFER)
+  CHECK(dataBytes <= sizeof(uint32_t));
+#elif defined(OLEDDISPLAY_SEGMENT_HASHES)
+  CHECK(dataBytes == OLEDDISPLAY_HASH_SEGMENT_WIDTH);
+#endif
+  CHECK(display.getFrameStats().transactions >= 1);
+
+  display.display();
+  checkFrame(display, false);
+  display.end();
+}
+
+// scrollPages() sends the page that came into view, not the whole screen
+static void testScrollPages(SSD1306Virtual &display) {
+  display.init();
+  char text[16];
+  display.setFont(ArialMT_Plain_10);
+  for (uint8_t line = 0; line < 12; line++) {
+    display.scrollPages(1);
+    display.drawStringf(0, display.height() - 8, text, "Line %d", line);
+    display.display();
+    checkFrame(display, true);
+#if !defined(OLEDDISPLAY_REDUCE_MEMORY) || defined(OLEDDISPLAY_SEGMENT_HASHES) || defined(OLEDDISPLAY_DIRTY_TRACKING)
+    CHECK(display.getFrameStats().dataBytes <= display.width());
+#endif
+  }
+  display.end();
+}
+
+// Font with a glyph whose raster is wider than its advance, like the
+// overhangs of italic fonts made with the font tool: 'A' advances 3 columns
+// but has 6 columns of raster
+static const uint8_t overhangFont[] = {
+  0x08, // Width: 8
+  0x08, // Height: 8
+  0x41, // First Char: 65
+  0x01, // Numbers of Chars: 1
+
+  // Jump Table:
+  0x00, 0x00, 0x06, 0x03,  // 65:0
+
+  // Font Data:
+  0xFF, 0x81, 0x81, 0x81, 0x81, 0xFF,  // 65
+};
+
+static void checkConsoleFrame(SSD1306Virtual &display, const uint8_t *font, bool pageLines) {
+  checkFrame(display, true);
+#if !defined(OLEDDISPLAY_REDUCE_MEMORY) || defined(OLEDDISPLAY_SEGMENT_HASHES) || defined(OLEDDISPLAY_DIRTY_TRACKING)
+  if (pageLines) {
+    // font[1] is the height of the font
+    CHECK(display.getFrameStats().dataBytes <= (uint32_t) (font[1] + 7) / 8 * display.width());
+  }
+#else
+  (void) font; (void) pageLines;
+#endif
+}
+
+// The Print console scrolls with the display start line when its lines are
+// whole pages apart, then a new line only sends the pages it is drawn on
+static void testConsole(SSD1306Virtual &display) {
+  static const uint8_t *consoleFonts[] = { ArialMT_Plain_10, ArialMT_Plain_16_Packed, ArialMT_Plain_24, overhangFont };
+  display.init();
+  for (const uint8_t *font : consoleFonts) {
+    bool pageLines = font[1] % 8 == 0;
+#ifdef OLEDDISPLAY_LOG_PAGE_LINES
+    pageLines = true;
+#endif
+    display.setFont(font);
+    display.cls();
+    for (uint8_t line = 0; line < 12; line++) {
+      // overhangFont only has an 'A', so the lines differ in their number of
+      // them. Moving identical lines in software would cost nothing.
+      display.printf("%.*s Line %d", line % 4 + 16, "AAAAAAAAAAAAAAAAAAAA", line);
+      checkConsoleFrame(display, font, pageLines);
+      display.println();
+      checkConsoleFrame(display, font, pageLines);
+    }
+  }
+  display.end();
+}
+
+// The whole raster of a glyph is sent, also when dirty tracking only sends
+// what was drawn
+static void testWideGlyphs(SSD1306Virtual &display) {
+  display.init();
+  display.display();
+  display.setFont(overhangFont);
+  display.setTextAlignment(TEXT_ALIGN_LEFT);
+  display.drawString(display.width() / 2, 8, "A");
+  display.display();
+  CHECK(display.matchesBuffer());
+  // The last column of the raster, on page 1
+  CHECK(display.buffer[display.width() + display.width() / 2 + 5] == 0xFF);
+  display.end();
+}
+
+// A flash string line longer than OLEDDISPLAY_FLASH_LINE_LENGTH, with a UTF-8
+// sequence across the end of the first chunk
+#define LONG_LINE_START "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz012"
+#define LONG_LINE LONG_LINE_START "\xC3\xBC" LONG_LINE_START "|end"
+
+// Long flash string lines are drawn whole, like the same text from RAM
+static void testFlashStrings(SSD1306Virtual &display) {
+  static const OLEDDISPLAY_TEXT_ALIGNMENT alignments[] = { TEXT_ALIGN_LEFT, TEXT_ALIGN_CENTER, TEXT_ALIGN_RIGHT, TEXT_ALIGN_CENTER_BOTH };
+  static_assert(sizeof(LONG_LINE_START) == OLEDDISPLAY_FLASH_LINE_LENGTH, "The UTF-8 sequence has to cross the end of the first chunk");
+  const uint16_t size = fullFrameBytes(display);
+  uint8_t *expected = (uint8_t *) malloc(size);
+  display.init();
+  display.setFont(ArialMT_Plain_10);
+  for (OLEDDISPLAY_TEXT_ALIGNMENT alignment : alignments) {
+    display.setTextAlignment(alignment);
+    const uint16_t lineWidth = display.getStringWidth(LONG_LINE);
+    const int16_t xs[] = { 0, (int16_t) (display.width() / 2), (int16_t) (-lineWidth / 2), (int16_t) (display.width() - lineWidth + 20) };
+    for (int16_t x : xs) {
+      display.clear();
+      uint16_t drawn = display.drawString(x, 20, LONG_LINE "\n" LONG_LINE);
+      memcpy(expected, display.buffer, size);
+      display.clear();
+      CHECK(display.drawString(x, 20, F(LONG_LINE "\n" LONG_LINE)) == drawn);
+      CHECK(memcmp(display.buffer, expected, size) == 0);
+    }
+  }
+  display.end();
+  free(expected);
+}
+
+// The scroll engine gets its settings in one batch of commands and moves the
+// display RAM like stopScrollAfter() moves the buffer
+static void testScrollEngine(SSD1306Virtual &display) {
+  static const uint8_t rowsPerStep[] = { 0, 3 };
+  display.init();
+  for (uint8_t rows : rowsPerStep) {
+    for (uint8_t op = 0; op < 8; op++) {
+      drawRandom(display);
+    }
+    if (!display.startDiagonalScroll(SCROLL_LEFT, 0, display.height() / 8 - 1, rows, SCROLL_INTERVAL_2_FRAMES)) {
+      // No scroll engine (SH1106)
+      break;
+    }
+    CHECK(display.isScrollEngineOn());
+    display.advanceScroll(37);
+    display.stopScrollAfter(37);
+    CHECK(!display.isScrollEngineOn());
+    CHECK(display.matchesBuffer());
+  }
+  display.end();
+}
+
+// The state of the dirty tracking and segment hashes lives in the object,
+// init() and end() must neither allocate nor free it
+static void testFixedStorage() {
+  currentCase = "fixedStorage/SSD1306/128x64";
+  OLEDDisplayFixed<SSD1306Virtual, 128, 64> display;
+  CHECK(display.getStateSize() == OLEDDISPLAY_STATE_SIZE(128, 64));
+  testRandomDrawing(display);
+  testRandomDrawing(display);
+
+  currentCase = "fixedStorage/SH1106/128x32";
+  OLEDDisplayFixed<SH1106Virtual, 128, 32> sh1106;
+  CHECK(sh1106.getStateSize() == OLEDDISPLAY_STATE_SIZE(128, 32));
+  testRandomDrawing(sh1106);
+  testRandomDrawing(sh1106);
+}
+
+typedef void (*TestFunction)(SSD1306Virtual &display);
+
+static void runTest(const char *name, TestFunction test) {
+  char caseName[64];
+  for (const TestGeometry &geometry : geometries) {
+    SSD1306Virtual ssd1306(geometry.geometry);
+    snprintf(caseName, sizeof(caseName), "%s/SSD1306/%s", name, geometry.name);
+    currentCase = caseName;
+    test(ssd1306);
+
+    // The SH1106 driver supports the full size geometries
+    if (geometry.geometry == GEOMETRY_128_64 || geometry.geometry == GEOMETRY_128_32) {
+      SH1106Virtual sh1106(geometry.geometry);
+      snprintf(caseName, sizeof(caseName), "%s/SH1106/%s", name, geometry.name);
+      currentCase = caseName;
+      test(sh1106);
+    }
+  }
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+      seed = strtoul(argv[++i], NULL, 0);
+    }
+  }
+  for (uint8_t i = 0; i < sizeof(image); i++) {
+    image[i] = (uint8_t) (i * 37 + 11);
+  }
+
+  runTest("randomDrawing", testRandomDrawing);
+  runTest("async", testAsync);
+  runTest("byteCounts", testByteCounts);
+  runTest("scrollPages", testScrollPages);
+  runTest("console", testConsole);
+  runTest("wideGlyphs", testWideGlyphs);
+  runTest("scrollEngine", testScrollEngine);
+  runTest("flashStrings", testFlashStrings);
+  testFixedStorage();
+
+  printf("%s: %u checks, %u failed\n", OLEDDISPLAY_TEST_CONFIG, checks, failures);
+  return failures ? 1 : 0;
+}